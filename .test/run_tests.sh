@@ -5,7 +5,7 @@ files=`find $parentdir/src/*/tests/*.cpp`
 for file in $(echo $files | tr "\n" "\n")
 do
   echo "$file"
-  g++ -std=c++17 $file -o ./tmp
+  g++ -std=c++17 -pthread $file -o ./tmp
   ./tmp
 done
 
@@ -0,0 +1,67 @@
+#include <chrono>
+#include <random>
+#include <mutex>
+#include <thread>
+#include <iostream>
+#include "../src/fenwick_tree.h"
+#include "../src/concurrent_fenwick_tree.h"
+
+/*
+ * Add throughput with 1 - 64 writer threads: a fenwick_tree guarded by a mutex,
+ * a concurrent_fenwick_tree with atomic adds and the same tree with a shard per thread.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 -pthread concurrent_fenwick_tree_benchmark.cpp
+ */
+
+constexpr std::size_t SIZE = 1UL << 16;
+constexpr int ADDS = 1000000; // per thread
+
+template<typename Add>
+double adds_per_second(const unsigned threads, Add add) {
+    std::vector<std::thread> writers;
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned t = 0; t < threads; ++t) {
+        writers.emplace_back([&add, t] {
+            std::mt19937_64 gen(t);
+            for (int i = 0; i < ADDS; ++i) {
+                // a skewed distribution, low indexes (and the nodes they share) are the hot ones
+                const std::size_t a = gen() % SIZE, b = gen() % SIZE;
+                add(std::min(a, b) / 16, 1);
+            }
+        });
+    }
+    for (auto &w : writers) {
+        w.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return (double) threads * ADDS / seconds;
+}
+
+int main() {
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        algo_lib::tree::fenwick_tree<long long> guarded(SIZE);
+        std::mutex global;
+        algo_lib::tree::concurrent_fenwick_tree<long long> atomic(SIZE);
+        algo_lib::tree::concurrent_fenwick_tree<long long> sharded(SIZE, threads);
+
+        const double mutex_aps = adds_per_second(threads, [&](std::size_t i, long long v) {
+            std::lock_guard<std::mutex> guard(global);
+            guarded.add(i, v);
+        });
+        const double atomic_aps = adds_per_second(threads, [&](std::size_t i, long long v) {
+            atomic.add(i, v);
+        });
+        const double sharded_aps = adds_per_second(threads, [&](std::size_t i, long long v) {
+            sharded.add(i, v);
+        });
+
+        const bool same = guarded.sum(SIZE - 1) == atomic.sum(SIZE - 1) && atomic.sum(SIZE - 1) == sharded.sum(SIZE - 1);
+        std::cout << threads << " threads, global mutex: " << (unsigned long) (mutex_aps / 1000)
+                  << "k adds/s, atomic: " << (unsigned long) (atomic_aps / 1000)
+                  << "k adds/s, sharded: " << (unsigned long) (sharded_aps / 1000) << "k adds/s"
+                  << (same ? "" : " (MISMATCH)") << std::endl;
+    }
+}
@@ -0,0 +1,56 @@
+#include <chrono>
+#include <random>
+#include <iostream>
+#include "../src/fenwick_tree.h"
+
+/*
+ * Compares the k-th element queries on a frequency table: a binary search over sum (O(log^2(n))),
+ * the lower_bound descent (O(log(n))) and the batched descent.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 lower_bound_benchmark.cpp
+ */
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    using fenwick = algo_lib::tree::fenwick_tree<long long>;
+    std::mt19937_64 gen(42);
+
+    for (std::size_t n : {1000UL, 100000UL, 10000000UL}) {
+        std::vector<long long> frequencies(n);
+        for (auto &f : frequencies) f = (long long) (gen() % 10);
+        fenwick tree(frequencies.begin(), frequencies.end());
+
+        constexpr std::size_t QUERIES = 1000000;
+        const long long total = tree.sum(n - 1);
+        std::vector<long long> ks(QUERIES);
+        for (auto &k : ks) k = (long long) (gen() % total) + 1;
+
+        std::size_t checksum_search = 0, checksum_descent = 0, checksum_batch = 0;
+        double search_time = measure([&] {
+            for (const long long k : ks) {
+                std::size_t lo = 0, hi = n;
+                while (lo < hi) {
+                    const std::size_t mid = (lo + hi) / 2;
+                    if (tree.sum(mid) < k) lo = mid + 1; else hi = mid;
+                }
+                checksum_search += lo;
+            }
+        });
+        double descent_time = measure([&] {
+            for (const long long k : ks) checksum_descent += tree.lower_bound(k);
+        });
+        double batch_time = measure([&] {
+            for (const std::size_t position : tree.lower_bound(ks)) checksum_batch += position;
+        });
+
+        std::cout << "n = " << n << ", binary search: " << search_time << " ms, lower_bound: " << descent_time
+                  << " ms, batched lower_bound: " << batch_time << " ms"
+                  << (checksum_search == checksum_descent && checksum_descent == checksum_batch ? "" : " (MISMATCH)")
+                  << std::endl;
+    }
+}
@@ -0,0 +1,165 @@
+#ifndef SRC_CONCURRENT_FENWICK_TREE_H
+#define SRC_CONCURRENT_FENWICK_TREE_H
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <limits>
+#include <cstddef>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+namespace algo_lib {
+    namespace tree {
+        namespace detail {
+            /**
+             * @return a small number assigned to the calling thread on its first call, 0, 1, 2, ...
+             */
+            inline unsigned thread_slot() noexcept {
+                static std::atomic<unsigned> next{0};
+                static thread_local const unsigned slot = next.fetch_add(1, std::memory_order_relaxed);
+
+                return slot;
+            }
+        }
+
+        /**
+         * Fenwick tree which can be updated and queried by many threads at once, without locks.
+         * @tparam T an integer type of values stored in a tree
+         * @tparam Index an integer type of indexes
+         *
+         * Every node is a std::atomic<T>, add does a relaxed fetch_add on every node of its path,
+         * so it is lock free (wait free when the atomics are).
+         *
+         * Every add to arr[p] changes exactly one of the nodes read by sum(i) if p <= i (and none otherwise),
+         * so a sum counts every add finished before it started, none of the adds started after it ended,
+         * and every concurrent add either as a whole or not at all. It is weaker than linearizability:
+         * two concurrent adds may be seen in different orders by different readers, and interval_sum
+         * (two prefix sums) may see an add to arr[0, i - 1] in one of them only.
+         * When there are no concurrent adds, the results are exact.
+         *
+         * With shards > 1 every thread adds to its own copy of a tree (chosen by a thread number),
+         * so the threads do not contend on the hot nodes (f.e. the ones with low indexes),
+         * and sum merges all of the copies, which makes the reads shards times more expensive.
+         */
+        template<typename T = long long, typename Index = std::size_t>
+        class concurrent_fenwick_tree {
+            static_assert(std::is_integral<T>::value, "Values of a concurrent fenwick tree are updated with fetch_add.");
+            static_assert(std::is_integral<Index>::value, "Indexes of a fenwick tree should be integers.");
+
+        public:
+
+            /**
+             * @param n number of elements stored in a tree, all of them are equal to 0
+             * @param shards the number of copies of a tree, the updates are spread between them
+             */
+            explicit concurrent_fenwick_tree(const Index n, const unsigned shards = 1)
+                    : size(n), shards(shards) {
+                if (n < 0 || n > std::numeric_limits<Index>::max() / 2) {
+                    throw std::length_error("Size of a fenwick tree is out of the supported range.");
+                }
+                if (shards < 1) {
+                    throw std::out_of_range("The number of shards should exceed 1.");
+                }
+
+                // every shard starts at a cache line boundary and takes whole cache lines,
+                // so two shards never share a cache line
+                constexpr std::size_t per_line = cache_line / sizeof(std::atomic<T>) > 0 ? cache_line / sizeof(std::atomic<T>) : 1;
+                stride = ((std::size_t) n + per_line) / per_line * per_line;
+
+                const std::size_t bytes = (stride * shards * sizeof(std::atomic<T>) + cache_line - 1)
+                                          / cache_line * cache_line;
+                void *memory = std::aligned_alloc(cache_line, bytes);
+                if (memory == nullptr) {
+                    throw std::bad_alloc();
+                }
+
+                arr.reset(static_cast<std::atomic<T> *>(memory));
+                for (std::size_t node = 0; node < stride * shards; ++node) {
+                    new(&arr[node]) std::atomic<T>(T(0));
+                }
+            }
+
+            /**
+             * Adds delta to arr[i], lock free
+             */
+            void add(Index i, const T delta) {
+                is_in_bounds(i);
+                std::atomic<T> *shard = arr.get() + (shards == 1 ? 0 : detail::thread_slot() % shards) * stride;
+                ++i;
+
+                while (i <= size) {
+                    shard[i].fetch_add(delta, std::memory_order_relaxed);
+                    i += leastSignificantBit(i);
+                }
+            }
+
+            /**
+             * @return sum of arr[0, i] (inclusive), merged from all of the shards
+             */
+            T sum(Index i) const {
+                is_in_bounds(i);
+                T sum = T(0);
+                ++i;
+
+                while (i > 0) {
+                    for (std::size_t shard = 0; shard < shards; ++shard) {
+                        sum += arr[shard * stride + i].load(std::memory_order_relaxed);
+                    }
+                    i -= leastSignificantBit(i);
+                }
+
+                return sum;
+            }
+
+            /**
+             * @return sum of an arr[i, j] (inclusive)
+             */
+            T interval_sum(const Index i, const Index j) const {
+                if (i > j) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+
+                return i == 0 ? sum(j) : sum(j) - sum(i - 1);
+            }
+
+            Index length() const noexcept {
+                return size;
+            }
+
+            unsigned shard_count() const noexcept {
+                return shards;
+            }
+
+        private:
+            static Index leastSignificantBit(const Index i) noexcept {
+                return i & (~i + 1);
+            }
+
+            void is_in_bounds(const Index i) const {
+                if (i < 0 || i >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            Index size;
+            unsigned shards;
+            std::size_t stride; // the number of nodes of a single shard, rounded up to whole cache lines
+            static constexpr std::size_t cache_line = 64;
+
+            /**
+             * Releases the memory of std::aligned_alloc, std::atomic<T> of an integer T is trivially destructible.
+             */
+            struct aligned_deleter {
+                void operator()(std::atomic<T> *memory) const noexcept {
+                    std::free(memory);
+                }
+            };
+
+            std::unique_ptr<std::atomic<T>[], aligned_deleter> arr; // shards one after another, node 0 of each is unused
+        };
+    }
+}
+
+#endif //SRC_CONCURRENT_FENWICK_TREE_H
@@ -2,31 +2,116 @@
 #define SRC_FENWICK_TREE_H
 
 #include <vector>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
 
 namespace algo_lib {
     namespace tree {
+        /**
+         * Abelian group policies for the fenwick_tree.
+         *
+         * Every group provides:
+         *  - static identity() - the neutral element,
+         *  - combine(lhs, rhs) - an associative and commutative operation,
+         *  - inverse(value) - the element which combined with @value gives the identity,
+         *  it is needed to calculate the sum of an interval from two prefix sums.
+         */
+        namespace groups {
+            template<typename T>
+            struct plus {
+                static constexpr T identity() noexcept {
+                    return T(0);
+                }
+
+                constexpr T combine(const T &lhs, const T &rhs) const {
+                    return lhs + rhs;
+                }
+
+                constexpr T inverse(const T &value) const {
+                    return -value;
+                }
+            };
+
+            template<typename T>
+            struct bitwise_xor {
+                static constexpr T identity() noexcept {
+                    return T(0);
+                }
+
+                constexpr T combine(const T &lhs, const T &rhs) const {
+                    return lhs ^ rhs;
+                }
+
+                constexpr T inverse(const T &value) const {
+                    return value;
+                }
+            };
+        }
+
+        /**
+         * Fenwick tree implementation for interval sums.
+         * @tparam T a type of values stored in a tree
+         * @tparam Index an integer type of indexes, std::size_t by default, so tables with billions
+         * of entries can be indexed
+         * @tparam group an abelian group policy, see the groups namespace above
+         */
+        template<typename T = int, typename Index = std::size_t, typename group = groups::plus<T>>
         class fenwick_tree {
+            static_assert(std::is_integral<Index>::value, "Indexes of a fenwick tree should be integers.");
+
         public:
 
             /**
              * Fenwick tree implementation for interval sums.
              * @param n number of elements stored in a tree
              */
-            fenwick_tree(unsigned long n)
-                    : size((int) n) {
-                arr.resize(n + 1, 0);
+            fenwick_tree(const Index n, const group operations = group())
+                    : size(n), operations(operations) {
+                // i + leastSignificantBit(i) can reach 2 * n, which has to be representable
+                if (n < 0 || n > std::numeric_limits<Index>::max() / 2) {
+                    throw std::length_error("Size of a fenwick tree is out of the supported range.");
+                }
+
+                arr.resize((std::size_t) n + 1, group::identity());
+            }
+
+            /**
+             * Builds a tree from [first, last) in O(n) time, instead of n calls to add.
+             * Every value is pushed once to its direct parent in the implicit tree.
+             * @param first a forward iterator (indicating the beginning)
+             * @param last a forward iterator (indicating the end)
+             */
+            template<typename ForwardIterator,
+                    typename = typename std::iterator_traits<ForwardIterator>::iterator_category>
+            fenwick_tree(ForwardIterator first, ForwardIterator last, const group operations = group())
+                    : fenwick_tree((Index) std::distance(first, last), operations) {
+                Index i = 1;
+                for (; first != last; ++first, ++i) {
+                    arr[i] = *first;
+                }
+
+                for (i = 1; i <= size; ++i) {
+                    const Index parent = i + leastSignificantBit(i);
+                    if (parent <= size) {
+                        arr[parent] = this->operations.combine(arr[parent], arr[i]);
+                    }
+                }
             }
 
             /**
-             * @param i index of an array, greater than 0 and less than n + 1
+             * @param i index of an array, greater than or equal to 0 and less than n
              * @return sum of arr[0, i] (inclusive)
              */
-            int sum(int i) {
-                int sum = 0;
+            T sum(Index i) const {
+                is_in_bounds(i);
+                T sum = group::identity();
                 ++i;
 
                 while (i > 0) {
-                    sum += arr[i];
+                    sum = operations.combine(sum, arr[i]);
                     i -= leastSignificantBit(i);
                 }
 
@@ -38,11 +123,12 @@ namespace algo_lib {
              * @param i index to add the delta value to
              * @param delta value which should be added to arr[i]
              */
-            void add(int i, int delta) {
+            void add(Index i, const T delta) {
+                is_in_bounds(i);
                 ++i;
 
-                while (i < size) {
-                    arr[i] += delta;
+                while (i <= size) {
+                    arr[i] = operations.combine(arr[i], delta);
                     i += leastSignificantBit(i);
                 }
             }
@@ -52,21 +138,105 @@ namespace algo_lib {
              * @param j right bound
              * @return sum of an arr[i, j] (inclusive)
              */
-            int interval_sum(int i, int j) {
-                return sum(j) - sum(i - 1);
+            T interval_sum(const Index i, const Index j) const {
+                if (i > j) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+
+                return i == 0 ? sum(j) : operations.combine(sum(j), operations.inverse(sum(i - 1)));
+            }
+
+            /**
+             * Finds the smallest index whose prefix sum is not less than @k, in O(log(n)) time,
+             * f.e. the k-th element (or a percentile) of a frequency table.
+             * Prefix sums have to be non-decreasing (all of the elements are non-negative).
+             * @param k searched prefix sum
+             * @return the smallest i such that sum(i) >= k, or length() if there is no such i
+             *
+             * Instead of a binary search over sum (O(log^2(n))), it walks down the implicit tree,
+             * trying to extend the current prefix by every power of two, from the largest one.
+             */
+            Index lower_bound(T k) const {
+                Index position = 0;
+
+                for (Index step = highest_step(); step > 0; step >>= 1) {
+                    const Index next = position + step;
+
+                    if (next <= size && arr[next] < k) {
+                        position = next;
+                        k = operations.combine(k, operations.inverse(arr[next]));
+                    }
+                }
+
+                return position;
+            }
+
+            /**
+             * lower_bound for many values at once, the result for ks[i] is written to the i-th position.
+             *
+             * The descents go level by level together, so at every level all of the queries read
+             * from the same (cached) part of the tree, and the reads of different queries do not
+             * depend on each other and can overlap.
+             */
+            std::vector<Index> lower_bound(const std::vector<T> &ks) const {
+                std::vector<Index> positions(ks.size(), 0);
+                std::vector<T> remaining(ks);
+
+                for (Index step = highest_step(); step > 0; step >>= 1) {
+                    for (std::size_t query = 0; query < ks.size(); ++query) {
+                        const Index next = positions[query] + step;
+
+                        if (next <= size && arr[next] < remaining[query]) {
+                            positions[query] = next;
+                            remaining[query] = operations.combine(remaining[query], operations.inverse(arr[next]));
+                        }
+                    }
+                }
+
+                return positions;
+            }
+
+            /**
+             * @return the number of elements stored in a tree
+             */
+            Index length() const noexcept {
+                return size;
             }
 
         private:
 
             /**
-             * @return int (in decimal) - the least significant bit of a given number
+             * @return the largest power of two not greater than the size (0 for an empty tree)
              */
-            int leastSignificantBit(int i) {
-                return i & -i;
+            Index highest_step() const noexcept {
+                if (size == 0) {
+                    return 0;
+                }
+
+                Index step = 1;
+                while (step <= size / 2) {
+                    step <<= 1;
+                }
+
+                return step;
+            }
+
+            /**
+             * @return the least significant bit of a given number
+             */
+            static Index leastSignificantBit(const Index i) noexcept {
+                return i & (~i + 1);
+            }
+
+            void is_in_bounds(const Index i) const {
+                if (i < 0 || i >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
             }
 
-            int size;
-            std::vector<int> arr;
+            Index size;
+            group operations;
+            std::vector<T> arr;
         };
     }
 }
@@ -0,0 +1,365 @@
+#ifndef SRC_MULTI_FENWICK_TREE_H
+#define SRC_MULTI_FENWICK_TREE_H
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "fenwick_tree.h"
+
+namespace algo_lib {
+    namespace tree {
+        /**
+         * N-dimensional fenwick tree, point add and hyper-rectangle sums in O(log^d(n)) time.
+         * @tparam T a type of values stored in a tree
+         * @tparam dimensions the number of dimensions (d)
+         * @tparam group an abelian group policy, see the groups namespace in fenwick_tree.h
+         *
+         * All of the nodes are kept in one contiguous buffer in the row major order, the last dimension
+         * is the innermost one, so a tree with extents (rows, n) replaces the rows separate fenwick_tree objects.
+         */
+        template<typename T = long long, std::size_t dimensions = 2, typename group = groups::plus<T>>
+        class multi_fenwick_tree {
+            static_assert(dimensions > 0, "A fenwick tree should have at least one dimension.");
+
+        public:
+            using point = std::array<std::size_t, dimensions>;
+
+            /**
+             * @param extents the number of elements in every dimension, all of them are identities at the beginning
+             */
+            explicit multi_fenwick_tree(const point &extents, const group operations = group())
+                    : extents(extents), operations(operations) {
+                std::size_t total = 1;
+
+                for (std::size_t dim = dimensions; dim-- > 0;) {
+                    if (extents[dim] < 1) {
+                        throw std::out_of_range("Size of a tree should exceed 1.");
+                    }
+                    if (extents[dim] >= std::numeric_limits<std::size_t>::max() / 2
+                        || total > std::numeric_limits<std::size_t>::max() / (extents[dim] + 1)) {
+                        throw std::length_error("Size of a fenwick tree is out of the supported range.");
+                    }
+
+                    strides[dim] = total;
+                    total *= extents[dim] + 1;
+                }
+
+                arr.resize(total, group::identity());
+            }
+
+            /**
+             * Adds delta to arr[p]
+             */
+            void add(const point &p, const T delta) {
+                is_in_bounds(p);
+                add_along<0>(0, p, delta);
+            }
+
+            /**
+             * @return sum of all of the elements with every coordinate less than or equal to the coordinate of @p
+             */
+            T sum(const point &p) const {
+                is_in_bounds(p);
+
+                point counts;
+                for (std::size_t dim = 0; dim < dimensions; ++dim) {
+                    counts[dim] = p[dim] + 1;
+                }
+
+                return prefix<0>(0, counts);
+            }
+
+            /**
+             * @param low the lowest corner of a hyper-rectangle
+             * @param high the highest corner of a hyper-rectangle
+             * @return sum of all of the elements inside [low, high] (inclusive in every dimension)
+             *
+             * It combines 2^d prefix sums with the inclusion-exclusion principle.
+             */
+            T rectangle_sum(const point &low, const point &high) const {
+                for (std::size_t dim = 0; dim < dimensions; ++dim) {
+                    if (low[dim] > high[dim]) {
+                        throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                    }
+                }
+                is_in_bounds(high);
+
+                T result = group::identity();
+                for (std::size_t corner = 0; corner < ((std::size_t) 1 << dimensions); ++corner) {
+                    point counts;
+                    bool empty = false, negative = false;
+
+                    for (std::size_t dim = 0; dim < dimensions; ++dim) {
+                        if (corner >> dim & 1) {
+                            counts[dim] = low[dim];
+                            empty |= low[dim] == 0;
+                            negative = !negative;
+                        } else {
+                            counts[dim] = high[dim] + 1;
+                        }
+                    }
+
+                    if (!empty) {
+                        const T value = prefix<0>(0, counts);
+                        result = operations.combine(result, negative ? operations.inverse(value) : value);
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * @return the number of elements in every dimension
+             */
+            const point &shape() const noexcept {
+                return extents;
+            }
+
+        private:
+            template<std::size_t dim>
+            void add_along(const std::size_t offset, const point &p, const T &delta) {
+                for (std::size_t i = p[dim] + 1; i <= extents[dim]; i += leastSignificantBit(i)) {
+                    if constexpr (dim + 1 == dimensions) {
+                        T &node = arr[offset + i * strides[dim]];
+                        node = operations.combine(node, delta);
+                    } else {
+                        add_along<dim + 1>(offset + i * strides[dim], p, delta);
+                    }
+                }
+            }
+
+            /**
+             * @param counts the number of leading elements taken in every dimension
+             */
+            template<std::size_t dim>
+            T prefix(const std::size_t offset, const point &counts) const {
+                T sum = group::identity();
+
+                for (std::size_t i = counts[dim]; i > 0; i -= leastSignificantBit(i)) {
+                    if constexpr (dim + 1 == dimensions) {
+                        sum = operations.combine(sum, arr[offset + i * strides[dim]]);
+                    } else {
+                        sum = operations.combine(sum, prefix<dim + 1>(offset + i * strides[dim], counts));
+                    }
+                }
+
+                return sum;
+            }
+
+            static std::size_t leastSignificantBit(const std::size_t i) noexcept {
+                return i & (~i + 1);
+            }
+
+            void is_in_bounds(const point &p) const {
+                for (std::size_t dim = 0; dim < dimensions; ++dim) {
+                    if (p[dim] >= extents[dim]) {
+                        throw std::out_of_range("Provided index is out of range.");
+                    }
+                }
+            }
+
+            point extents;
+            point strides; // distance (in the buffer) between two consecutive nodes of a dimension
+            group operations;
+            std::vector<T> arr;
+        };
+
+        /**
+         * N-dimensional fenwick tree over arbitrary (f.e. sparse or negative) coordinates.
+         * @tparam Coordinate a type of coordinates, it has to be less than comparable
+         *
+         * The points which will be updated (m of them) have to be known in advance. It is an offline
+         * fenwick tree of fenwick trees: the first dimension is compressed to the distinct coordinates
+         * of the points and every node of its tree keeps a (d - 1)-dimensional tree built only from the
+         * points in the node's range, down to the last dimension, whose nodes keep plain sorted coordinates
+         * and sums. A point belongs to O(log(m)) nodes of every dimension but the last one, so the structure
+         * takes O(m * log^(d - 1)(m)) memory (never a dense grid of the distinct coordinates, which could
+         * take m^d cells), and add / rectangle_sum take O(log^d(m)) time. The queries may use any coordinates.
+         */
+        template<typename T = long long, std::size_t dimensions = 2, typename Coordinate = long long,
+                typename group = groups::plus<T>>
+        class compressed_multi_fenwick_tree {
+            static_assert(dimensions > 0, "A fenwick tree should have at least one dimension.");
+
+        public:
+            using point = std::array<Coordinate, dimensions>;
+
+            /**
+             * Builds a tree in O(m * log^(d - 1)(m) * log(m)) time.
+             * @param first a forward iterator over the points which will be updated (indicating the beginning)
+             * @param last a forward iterator (indicating the end)
+             */
+            template<typename ForwardIterator>
+            compressed_multi_fenwick_tree(ForwardIterator first, ForwardIterator last,
+                                          const group operations = group())
+                    : operations(operations) {
+                const std::vector<point> points(first, last);
+
+                std::vector<const point *> all;
+                all.reserve(points.size());
+                for (const auto &p : points) {
+                    all.push_back(&p);
+                }
+
+                root = level<0>(all);
+            }
+
+            /**
+             * Adds delta to arr[p], @p has to be one of the points given in the constructor
+             */
+            void add(const point &p, const T delta) {
+                root.add(p, delta, operations);
+            }
+
+            /**
+             * @return sum of all of the elements inside [low, high] (inclusive in every dimension)
+             *
+             * It combines 2^d prefix sums with the inclusion-exclusion principle, a prefix is
+             * bounded by high[dim] (inclusive) or low[dim] (exclusive) in every dimension.
+             */
+            T rectangle_sum(const point &low, const point &high) const {
+                for (std::size_t dim = 0; dim < dimensions; ++dim) {
+                    if (high[dim] < low[dim]) {
+                        throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                    }
+                }
+
+                T result = group::identity();
+                for (std::size_t corner = 0; corner < ((std::size_t) 1 << dimensions); ++corner) {
+                    point bound;
+                    bool negative = false;
+
+                    for (std::size_t dim = 0; dim < dimensions; ++dim) {
+                        const bool lower = corner >> dim & 1;
+                        bound[dim] = lower ? low[dim] : high[dim];
+                        negative ^= lower;
+                    }
+
+                    const T value = root.prefix(bound, corner, operations);
+                    result = operations.combine(result, negative ? operations.inverse(value) : value);
+                }
+
+                return result;
+            }
+
+            /**
+             * @return the number of values kept in the innermost trees, O(m * log^(d - 1)(m))
+             */
+            std::size_t cells() const noexcept {
+                return root.cells();
+            }
+
+        private:
+            static std::size_t leastSignificantBit(const std::size_t i) noexcept {
+                return i & (~i + 1);
+            }
+
+            /**
+             * A tree over the dim-th coordinate of some of the points, its nodes (1-based) are the trees
+             * of the next dimension, or the sums for the last dimension.
+             */
+            template<std::size_t dim>
+            struct level {
+                static constexpr bool innermost = dim + 1 == dimensions;
+
+                level() = default;
+
+                explicit level(const std::vector<const point *> &points) {
+                    for (const point *p : points) {
+                        coordinates.push_back((*p)[dim]);
+                    }
+                    std::sort(coordinates.begin(), coordinates.end());
+                    coordinates.erase(std::unique(coordinates.begin(), coordinates.end()), coordinates.end());
+
+                    const std::size_t n = coordinates.size();
+                    if constexpr (innermost) {
+                        nodes.assign(n + 1, group::identity());
+                    } else {
+                        // a node i keeps the points whose coordinates are in (i - lsb(i), i]
+                        std::vector<std::vector<const point *>> ranges(n + 1);
+                        for (const point *p : points) {
+                            for (std::size_t i = index_of((*p)[dim]) + 1; i <= n; i += leastSignificantBit(i)) {
+                                ranges[i].push_back(p);
+                            }
+                        }
+
+                        nodes.resize(n + 1);
+                        for (std::size_t i = 1; i <= n; ++i) {
+                            nodes[i] = level<dim + 1>(ranges[i]);
+                            std::vector<const point *>().swap(ranges[i]);
+                        }
+                    }
+                }
+
+                void add(const point &p, const T &delta, const group &operations) {
+                    const auto it = std::lower_bound(coordinates.begin(), coordinates.end(), p[dim]);
+                    if (it == coordinates.end() || p[dim] < *it) {
+                        throw std::out_of_range("Provided point was not registered in a tree.");
+                    }
+
+                    for (std::size_t i = (std::size_t) (it - coordinates.begin()) + 1;
+                         i <= coordinates.size(); i += leastSignificantBit(i)) {
+                        if constexpr (innermost) {
+                            nodes[i] = operations.combine(nodes[i], delta);
+                        } else {
+                            nodes[i].add(p, delta, operations);
+                        }
+                    }
+                }
+
+                /**
+                 * @param exclusive a bit mask, the dimensions whose bounds are exclusive
+                 * @return sum of the points below @bound in every dimension
+                 */
+                T prefix(const point &bound, const std::size_t exclusive, const group &operations) const {
+                    const std::size_t count = (std::size_t) ((exclusive >> dim & 1)
+                                                             ? std::lower_bound(coordinates.begin(), coordinates.end(), bound[dim])
+                                                               - coordinates.begin()
+                                                             : std::upper_bound(coordinates.begin(), coordinates.end(), bound[dim])
+                                                               - coordinates.begin());
+
+                    T sum = group::identity();
+                    for (std::size_t i = count; i > 0; i -= leastSignificantBit(i)) {
+                        if constexpr (innermost) {
+                            sum = operations.combine(sum, nodes[i]);
+                        } else {
+                            sum = operations.combine(sum, nodes[i].prefix(bound, exclusive, operations));
+                        }
+                    }
+
+                    return sum;
+                }
+
+                std::size_t cells() const noexcept {
+                    if constexpr (innermost) {
+                        return coordinates.size();
+                    } else {
+                        std::size_t total = 0;
+                        for (std::size_t i = 1; i < nodes.size(); ++i) {
+                            total += nodes[i].cells();
+                        }
+
+                        return total;
+                    }
+                }
+
+                std::size_t index_of(const Coordinate &c) const {
+                    return (std::size_t) (std::lower_bound(coordinates.begin(), coordinates.end(), c) - coordinates.begin());
+                }
+
+                std::vector<Coordinate> coordinates; // sorted distinct coordinates of the points of this tree
+                std::conditional_t<innermost, std::vector<T>, std::vector<level<dim + 1>>> nodes;
+            };
+
+            group operations;
+            level<0> root;
+        };
+    }
+}
+
+#endif //SRC_MULTI_FENWICK_TREE_H
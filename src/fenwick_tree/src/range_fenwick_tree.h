@@ -0,0 +1,122 @@
+#ifndef SRC_RANGE_FENWICK_TREE_H
+#define SRC_RANGE_FENWICK_TREE_H
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include "fenwick_tree.h"
+
+namespace algo_lib {
+    namespace tree {
+        /**
+         * Fenwick tree with adding a value to the whole interval and interval sums,
+         * both of the operations take O(log(n)) time.
+         * @tparam T an arithmetic type of values stored in a tree
+         * @tparam Index an integer type of indexes
+         *
+         * It keeps two fenwick trees over the differences of the adjacent elements d[i] = a[i] - a[i - 1]:
+         * the first one stores d[i] and the second one d[i] * i, so that
+         * sum of a[0, i] = (i + 1) * (d[0] + ... + d[i]) - (0 * d[0] + ... + i * d[i]).
+         */
+        template<typename T = long long, typename Index = std::size_t>
+        class range_fenwick_tree {
+        public:
+            /**
+             * @param n number of elements stored in a tree, all of them are equal to 0
+             */
+            explicit range_fenwick_tree(const Index n)
+                    : differences(n), weighted_differences(n) {}
+
+            /**
+             * Builds a tree from [first, last) in O(n) time.
+             * @param first a forward iterator (indicating the beginning)
+             * @param last a forward iterator (indicating the end)
+             */
+            template<typename ForwardIterator,
+                    typename = typename std::iterator_traits<ForwardIterator>::iterator_category>
+            range_fenwick_tree(ForwardIterator first, ForwardIterator last)
+                    : range_fenwick_tree(differences_of(first, last)) {}
+
+            /**
+             * Adds delta to every element of arr[i, j] (inclusive)
+             */
+            void range_add(const Index i, const Index j, const T delta) {
+                if (i > j) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                if (j >= length()) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+
+                differences.add(i, delta);
+                weighted_differences.add(i, delta * (T) i);
+
+                if (j + 1 < length()) {
+                    differences.add(j + 1, -delta);
+                    weighted_differences.add(j + 1, -delta * (T) (j + 1));
+                }
+            }
+
+            /**
+             * Adds delta to arr[i]
+             */
+            void add(const Index i, const T delta) {
+                range_add(i, i, delta);
+            }
+
+            /**
+             * @return sum of arr[0, i] (inclusive)
+             */
+            T sum(const Index i) const {
+                return differences.sum(i) * (T) (i + 1) - weighted_differences.sum(i);
+            }
+
+            /**
+             * @return sum of an arr[i, j] (inclusive)
+             */
+            T interval_sum(const Index i, const Index j) const {
+                if (i > j) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+
+                return i == 0 ? sum(j) : sum(j) - sum(i - 1);
+            }
+
+            Index length() const noexcept {
+                return differences.length();
+            }
+
+        private:
+            explicit range_fenwick_tree(const std::vector<T> &d)
+                    : differences(d.begin(), d.end()),
+                      weighted_differences(weighted(d)) {}
+
+            template<typename ForwardIterator>
+            static std::vector<T> differences_of(ForwardIterator first, ForwardIterator last) {
+                std::vector<T> d;
+                T previous = T(0);
+
+                for (; first != last; ++first) {
+                    d.push_back(*first - previous);
+                    previous = *first;
+                }
+
+                return d;
+            }
+
+            static fenwick_tree<T, Index> weighted(std::vector<T> d) {
+                for (std::size_t i = 0; i < d.size(); ++i) {
+                    d[i] *= (T) i;
+                }
+
+                return fenwick_tree<T, Index>(d.begin(), d.end());
+            }
+
+            fenwick_tree<T, Index> differences;
+            fenwick_tree<T, Index> weighted_differences;
+        };
+    }
+}
+
+#endif //SRC_RANGE_FENWICK_TREE_H
@@ -0,0 +1,65 @@
+#define BOOST_TEST_MODULE concurrent_fenwick_tree_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <thread>
+#include "../src/concurrent_fenwick_tree.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(concurrent_adds) {
+        constexpr std::size_t SIZE = 100;
+        constexpr int THREADS = 4, ADDS = 20000;
+
+        for (unsigned shards : {1u, 3u}) {
+            algo_lib::tree::concurrent_fenwick_tree<long long> tree(SIZE, shards);
+            std::atomic<bool> done{false};
+            std::atomic<int> violations{0};
+
+            // all of the adds are positive, so no reader can see a prefix sum going down
+            std::thread reader([&] {
+                long long previous = 0;
+                do {
+                    const long long current = tree.sum(SIZE / 2);
+                    if (current < previous) {
+                        ++violations;
+                    }
+                    previous = current;
+                } while (!done);
+            });
+
+            std::vector<std::thread> writers;
+            for (int t = 0; t < THREADS; ++t) {
+                writers.emplace_back([&tree, t] {
+                    for (int i = 0; i < ADDS; ++i) {
+                        tree.add((std::size_t) (i + t) % SIZE, 1);
+                    }
+                });
+            }
+            for (auto &writer : writers) {
+                writer.join();
+            }
+            done = true;
+            reader.join();
+
+            BOOST_CHECK_EQUAL(violations.load(), 0);
+            BOOST_CHECK_EQUAL(tree.sum(SIZE - 1), (long long) THREADS * ADDS);
+            BOOST_CHECK_EQUAL(tree.interval_sum(10, 19), (long long) THREADS * ADDS / 10);
+            BOOST_CHECK_EQUAL(tree.shard_count(), shards);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(simple_test_case) {
+        algo_lib::tree::concurrent_fenwick_tree<int, int> tree(10, 2);
+
+        tree.add(0, 10);
+        tree.add(3, 30);
+        tree.add(3, -5);
+
+        BOOST_CHECK_EQUAL(tree.sum(2), 10);
+        BOOST_CHECK_EQUAL(tree.interval_sum(1, 9), 25);
+        BOOST_CHECK_THROW(tree.add(10, 1), std::out_of_range);
+        BOOST_CHECK_THROW(algo_lib::tree::concurrent_fenwick_tree<int>(10, 0), std::out_of_range);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -1,12 +1,14 @@
 #define BOOST_TEST_MODULE fenwick_tree_tests
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <numeric>
 #include "../src/fenwick_tree.h"
 
 BOOST_AUTO_TEST_SUITE(simple);
 
     BOOST_AUTO_TEST_CASE(simple_test_case) {
-        using fenwick = algo_lib::tree::fenwick_tree;
+        using fenwick = algo_lib::tree::fenwick_tree<>;
         constexpr int SIZE = 10;
         fenwick tree(SIZE);
 
@@ -26,4 +28,80 @@ BOOST_AUTO_TEST_SUITE(simple);
         BOOST_CHECK_EQUAL(tree.interval_sum(0, 2), 11);
     }
 
+    BOOST_AUTO_TEST_CASE(bulk_construction_64_bit) {
+        using fenwick = algo_lib::tree::fenwick_tree<long long, unsigned long long>;
+        constexpr unsigned long long SIZE = 1000;
+        constexpr long long BIG = 5000000000LL; // does not fit into an int
+
+        std::mt19937 gen(2);
+        std::vector<long long> values(SIZE);
+        for (auto &v : values) {
+            v = BIG + (long long) (gen() % 100);
+        }
+
+        fenwick built(values.begin(), values.end());
+        fenwick added(SIZE);
+        for (unsigned long long i = 0; i < SIZE; ++i) {
+            added.add(i, values[i]);
+        }
+
+        long long prefix = 0;
+        for (unsigned long long i = 0; i < SIZE; ++i) {
+            prefix += values[i];
+            BOOST_CHECK_EQUAL(built.sum(i), prefix);
+            BOOST_CHECK_EQUAL(added.sum(i), prefix);
+        }
+
+        built.add(SIZE - 1, 1);
+        BOOST_CHECK_EQUAL(built.interval_sum(SIZE - 1, SIZE - 1), values[SIZE - 1] + 1);
+        BOOST_CHECK_EQUAL(built.interval_sum(10, 19), std::accumulate(values.begin() + 10, values.begin() + 20, 0LL));
+        BOOST_CHECK_THROW(built.sum(SIZE), std::out_of_range);
+        BOOST_CHECK_THROW(built.interval_sum(5, 4), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(xor_group) {
+        using fenwick = algo_lib::tree::fenwick_tree<unsigned, int, algo_lib::tree::groups::bitwise_xor<unsigned>>;
+        std::vector<unsigned> values{5, 3, 12, 7, 1};
+        fenwick tree(values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(tree.interval_sum(1, 3), 3u ^ 12u ^ 7u);
+        tree.add(2, 12);
+        BOOST_CHECK_EQUAL(tree.interval_sum(1, 3), 3u ^ 7u);
+        BOOST_CHECK_EQUAL(tree.length(), 5);
+    }
+
+    BOOST_AUTO_TEST_CASE(lower_bound_against_binary_search) {
+        using fenwick = algo_lib::tree::fenwick_tree<int, unsigned>;
+
+        std::mt19937 gen(16);
+        for (unsigned size : {1u, 2u, 7u, 64u, 100u}) {
+            std::vector<int> frequencies(size);
+            for (auto &f : frequencies) {
+                f = (int) (gen() % 4); // zeros make plateaus of equal prefix sums
+            }
+            fenwick tree(frequencies.begin(), frequencies.end());
+
+            std::vector<int> prefix(size), ks;
+            std::partial_sum(frequencies.begin(), frequencies.end(), prefix.begin());
+            for (int k = -1; k <= prefix.back() + 1; ++k) {
+                ks.push_back(k);
+            }
+
+            const auto batch = tree.lower_bound(ks);
+            for (std::size_t i = 0; i < ks.size(); ++i) {
+                const auto expected = (unsigned) (std::lower_bound(prefix.begin(), prefix.end(), ks[i]) - prefix.begin());
+                BOOST_CHECK_EQUAL(tree.lower_bound(ks[i]), expected);
+                BOOST_CHECK_EQUAL(batch[i], expected);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(lower_bound_empty_tree) {
+        algo_lib::tree::fenwick_tree<> tree(0);
+
+        BOOST_CHECK_EQUAL(tree.lower_bound(1), 0);
+        BOOST_CHECK_EQUAL(tree.lower_bound(-1), 0);
+        BOOST_CHECK((tree.lower_bound(std::vector<int>{0, 1, 5}) == std::vector<std::size_t>{0, 0, 0}));
+    }
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
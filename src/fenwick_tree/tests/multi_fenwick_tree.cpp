@@ -0,0 +1,110 @@
+#define BOOST_TEST_MODULE multi_fenwick_tree_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include "../src/multi_fenwick_tree.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(grid_against_naive) {
+        constexpr std::size_t ROWS = 7, COLUMNS = 13;
+        algo_lib::tree::multi_fenwick_tree<long long, 2> tree({ROWS, COLUMNS});
+        std::vector<std::vector<long long>> naive(ROWS, std::vector<long long>(COLUMNS));
+
+        std::mt19937 gen(15);
+        for (int step = 0; step < 2000; ++step) {
+            std::size_t r1 = gen() % ROWS, r2 = gen() % ROWS, c1 = gen() % COLUMNS, c2 = gen() % COLUMNS;
+
+            if (step % 2) {
+                const long long delta = (long long) (gen() % 100) - 50;
+                tree.add({r1, c1}, delta);
+                naive[r1][c1] += delta;
+            } else {
+                if (r1 > r2) std::swap(r1, r2);
+                if (c1 > c2) std::swap(c1, c2);
+
+                long long expected = 0;
+                for (std::size_t r = r1; r <= r2; ++r)
+                    for (std::size_t c = c1; c <= c2; ++c)
+                        expected += naive[r][c];
+
+                BOOST_CHECK_EQUAL(tree.rectangle_sum({r1, c1}, {r2, c2}), expected);
+            }
+        }
+
+        BOOST_CHECK_THROW(tree.add({ROWS, 0}, 1), std::out_of_range);
+        BOOST_CHECK_THROW(tree.rectangle_sum({1, 3}, {0, 4}), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(cube_sums) {
+        algo_lib::tree::multi_fenwick_tree<int, 3> tree({4, 5, 6});
+
+        for (std::size_t x = 0; x < 4; ++x)
+            for (std::size_t y = 0; y < 5; ++y)
+                for (std::size_t z = 0; z < 6; ++z)
+                    tree.add({x, y, z}, 1);
+
+        BOOST_CHECK_EQUAL(tree.sum({3, 4, 5}), 120);
+        BOOST_CHECK_EQUAL(tree.sum({1, 1, 1}), 8);
+        BOOST_CHECK_EQUAL(tree.rectangle_sum({1, 2, 3}, {2, 4, 5}), 2 * 3 * 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(compressed_coordinates) {
+        using point = std::array<long long, 2>;
+        std::vector<point> points = {{-1000000000LL, 5}, {0, 5}, {7, -3}, {1LL << 40, 5}};
+
+        algo_lib::tree::compressed_multi_fenwick_tree<int, 2> tree(points.begin(), points.end());
+
+        for (const auto &p : points) {
+            tree.add(p, 1);
+        }
+        tree.add({0, 5}, 2);
+
+        BOOST_CHECK_EQUAL(tree.rectangle_sum({-2000000000LL, 0}, {1LL << 41, 10}), 5);
+        BOOST_CHECK_EQUAL(tree.rectangle_sum({-5, -10}, {10, 10}), 4);
+        BOOST_CHECK_EQUAL(tree.rectangle_sum({1, 0}, {6, 10}), 0);
+        BOOST_CHECK_THROW(tree.add({1, 5}, 1), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(compressed_scattered_cube) {
+        using point = std::array<long long, 3>;
+        constexpr std::size_t POINTS = 10000;
+
+        std::mt19937_64 gen(150);
+        std::vector<point> points(POINTS);
+        for (auto &p : points) {
+            p = {(long long) (gen() % 1000000000), (long long) (gen() % 1000000000) - 500000000, (long long) (gen() % 1000000000)};
+        }
+
+        // a dense grid of the distinct coordinates would take 10^12 cells
+        algo_lib::tree::compressed_multi_fenwick_tree<long long, 3> tree(points.begin(), points.end());
+        BOOST_CHECK_LE(tree.cells(), POINTS * 14 * 14);
+
+        std::vector<long long> values(POINTS);
+        for (std::size_t i = 0; i < POINTS; ++i) {
+            values[i] = (long long) (gen() % 100);
+            tree.add(points[i], values[i]);
+        }
+
+        for (int query = 0; query < 50; ++query) {
+            point low, high;
+            for (std::size_t dim = 0; dim < 3; ++dim) {
+                low[dim] = points[gen() % POINTS][dim];
+                high[dim] = points[gen() % POINTS][dim];
+                if (high[dim] < low[dim]) std::swap(low[dim], high[dim]);
+            }
+
+            long long expected = 0;
+            for (std::size_t i = 0; i < POINTS; ++i) {
+                bool inside = true;
+                for (std::size_t dim = 0; dim < 3; ++dim) {
+                    inside &= low[dim] <= points[i][dim] && points[i][dim] <= high[dim];
+                }
+                expected += inside ? values[i] : 0;
+            }
+
+            BOOST_CHECK_EQUAL(tree.rectangle_sum(low, high), expected);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,50 @@
+#define BOOST_TEST_MODULE range_fenwick_tree_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <numeric>
+#include "../src/range_fenwick_tree.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(range_add_against_naive) {
+        using fenwick = algo_lib::tree::range_fenwick_tree<long long>;
+        constexpr std::size_t SIZE = 50;
+
+        std::mt19937 gen(6);
+        std::vector<long long> naive(SIZE);
+        for (auto &v : naive) {
+            v = (long long) (gen() % 100) - 50;
+        }
+        fenwick tree(naive.begin(), naive.end());
+
+        for (int step = 0; step < 1000; ++step) {
+            std::size_t i = gen() % SIZE, j = gen() % SIZE;
+            if (i > j) std::swap(i, j);
+
+            if (step % 2) {
+                const long long delta = (long long) (gen() % 100) - 50;
+                tree.range_add(i, j, delta);
+                for (std::size_t k = i; k <= j; ++k) naive[k] += delta;
+            } else {
+                BOOST_CHECK_EQUAL(tree.interval_sum(i, j),
+                                  std::accumulate(naive.begin() + i, naive.begin() + j + 1, 0LL));
+            }
+        }
+
+        BOOST_CHECK_THROW(tree.range_add(3, SIZE, 1), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(simple_test_case) {
+        algo_lib::tree::range_fenwick_tree<int, int> tree(10);
+
+        tree.range_add(2, 5, 3);
+        tree.add(9, 4);
+
+        BOOST_CHECK_EQUAL(tree.sum(1), 0);
+        BOOST_CHECK_EQUAL(tree.sum(3), 6);
+        BOOST_CHECK_EQUAL(tree.interval_sum(5, 9), 7);
+        BOOST_CHECK_EQUAL(tree.length(), 10);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <random>
+#include <thread>
+#include <iostream>
+#include "../src/dense_find_union.h"
+#include "../src/concurrent_find_union.h"
+
+/*
+ * Ingestion of 10^7 random edges over 10^7 elements with union_batch on 1 - 64 threads,
+ * against the single-threaded dense_find_union.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 -pthread concurrent_find_union_benchmark.cpp
+ */
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    constexpr unsigned SIZE = 10000000;
+    std::mt19937 gen(42);
+
+    std::vector<std::pair<unsigned, unsigned>> edges(SIZE);
+    for (auto &edge : edges) {
+        edge = {gen() % SIZE, gen() % SIZE};
+    }
+
+    std::size_t expected = 0;
+    const double dense_time = measure([&] {
+        algo_lib::disjoint_sets::dense_find_union<> sets(SIZE);
+        for (const auto &edge : edges) {
+            sets.union_sets(edge.first, edge.second);
+        }
+        expected = sets.number_of_sets();
+    });
+
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl
+              << "dense_find_union: " << dense_time << " ms" << std::endl;
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        algo_lib::disjoint_sets::concurrent_find_union<> sets(SIZE);
+        const double time = measure([&] { sets.union_batch(edges, threads); });
+
+        std::cout << threads << " threads, concurrent_find_union: " << time << " ms"
+                  << (sets.number_of_sets() == expected ? "" : " (MISMATCH)") << std::endl;
+    }
+}
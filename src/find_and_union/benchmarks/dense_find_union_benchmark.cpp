@@ -0,0 +1,67 @@
+#include <chrono>
+#include <random>
+#include <numeric>
+#include <iostream>
+#include "../src/find_union.h"
+#include "../src/dense_find_union.h"
+
+/*
+ * n random unions and n random equal queries over 10^7 elements,
+ * the map based find_union against the dense_find_union.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 dense_find_union_benchmark.cpp
+ */
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<typename Sets>
+unsigned long run(Sets &sets, const std::vector<unsigned> &a, const std::vector<unsigned> &b) {
+    unsigned long checksum = 0;
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        sets.union_sets(a[i], b[i]);
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        checksum += sets.equal(b[i], a[a.size() - 1 - i]);
+    }
+
+    return checksum + sets.number_of_sets();
+}
+
+int main() {
+    constexpr unsigned SIZE = 10000000;
+    std::mt19937 gen(42);
+
+    std::vector<unsigned> a(SIZE), b(SIZE);
+    for (unsigned i = 0; i < SIZE; ++i) {
+        a[i] = gen() % SIZE;
+        b[i] = gen() % SIZE;
+    }
+
+    unsigned long map_checksum = 0, dense_checksum = 0;
+    double map_build = 0, map_time = 0, dense_build = 0, dense_time = 0;
+    {
+        std::vector<unsigned> keys(SIZE);
+        std::iota(keys.begin(), keys.end(), 0);
+
+        algo_lib::disjoint_sets::find_union<unsigned> *sets = nullptr;
+        map_build = measure([&] { sets = new algo_lib::disjoint_sets::find_union<unsigned>(keys); });
+        map_time = measure([&] { map_checksum = run(*sets, a, b); });
+        delete sets;
+    }
+    {
+        algo_lib::disjoint_sets::dense_find_union<unsigned> *sets = nullptr;
+        dense_build = measure([&] { sets = new algo_lib::disjoint_sets::dense_find_union<unsigned>(SIZE); });
+        dense_time = measure([&] { dense_checksum = run(*sets, a, b); });
+        delete sets;
+    }
+
+    std::cout << "n = " << SIZE << std::endl
+              << "find_union: build " << map_build << " ms, unions + queries " << map_time << " ms" << std::endl
+              << "dense_find_union: build " << dense_build << " ms, unions + queries " << dense_time << " ms"
+              << (map_checksum == dense_checksum ? "" : " (MISMATCH)") << std::endl;
+}
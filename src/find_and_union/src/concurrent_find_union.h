@@ -0,0 +1,181 @@
+#ifndef SRC_CONCURRENT_FIND_UNION_H
+#define SRC_CONCURRENT_FIND_UNION_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace algo_lib {
+    namespace disjoint_sets {
+
+        /**
+         * A find_union structure for the keys 0, 1, ..., n - 1, which can be used by many threads at once without locks.
+         * @tparam key an unsigned integer type of keys
+         *
+         * Every element keeps its parent in a std::atomic. A root is linked with a single compare and swap
+         * (which fails if the root has got a parent in the meantime, then the union starts again),
+         * always below the root with the greater key, so no cycle can be created by the concurrent unions.
+         * Find uses path splitting: every element on the path is moved to its grandparent with a compare and swap,
+         * a failed one is simply ignored, as somebody else has shortened the path already.
+         *
+         * union_sets and equal are linearizable, the operations are lock free.
+         */
+        template<typename key = unsigned>
+        class concurrent_find_union {
+            static_assert(std::is_integral<key>::value && std::is_unsigned<key>::value,
+                          "Keys of a concurrent find_union should be unsigned integers.");
+
+        public:
+            /**
+             * @brief Creates an %concurrent_find_union structure with @n singletons: 0, 1, ..., n - 1.
+             */
+            explicit concurrent_find_union(const key n)
+                    : n(n), parent(new std::atomic<key>[n]), _s(n) {
+                for (key k = 0; k < n; ++k) {
+                    parent[k].store(k, std::memory_order_relaxed);
+                }
+            }
+
+            /**
+             * @brief Finds an id of a set @current element is in.
+             * @param current An id of an element to find.
+             * @return An id of the set @current element is in, which may change when other threads
+             * merge the sets concurrently.
+             */
+            key find(key current) {
+                is_in_bounds(current);
+
+                while (true) {
+                    key up = parent[current].load(std::memory_order_acquire);
+                    if (up == current) {
+                        return current;
+                    }
+
+                    const key grandparent = parent[up].load(std::memory_order_acquire);
+                    if (up != grandparent) {
+                        parent[current].compare_exchange_weak(up, grandparent, std::memory_order_acq_rel,
+                                                              std::memory_order_relaxed);
+                    }
+                    current = up;
+                }
+            }
+
+            /**
+             * Merges two sets into one.
+             * @param first First set to merge.
+             * @param second Second set to merge.
+             * @return True if the sets were different (and this call merged them), false otherwise.
+             */
+            bool union_sets(const key first, const key second) {
+                key first_root = first, second_root = second;
+
+                while (true) {
+                    first_root = find(first_root);
+                    second_root = find(second_root);
+
+                    if (first_root == second_root) {
+                        return false;
+                    }
+
+                    if (first_root < second_root) {
+                        std::swap(first_root, second_root);
+                    }
+
+                    key expected = second_root;
+                    if (parent[second_root].compare_exchange_strong(expected, first_root, std::memory_order_acq_rel,
+                                                                    std::memory_order_relaxed)) {
+                        _s.fetch_sub(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+            }
+
+            /**
+             * @brief Checks whether the given elements are inside the same set.
+             * @return True if the root of both is the same, false otherwise.
+             */
+            bool equal(const key first, const key second) {
+                key first_root = first, second_root = second;
+
+                while (true) {
+                    first_root = find(first_root);
+                    second_root = find(second_root);
+
+                    if (first_root == second_root) {
+                        return true;
+                    }
+
+                    // the roots were different and the first one is still a root, so they were different at that moment
+                    if (parent[first_root].load(std::memory_order_acquire) == first_root) {
+                        return false;
+                    }
+                }
+            }
+
+            /**
+             * @brief Merges the pairs of sets, the pairs are split evenly between the threads.
+             * @param edges Pairs of elements whose sets should be merged.
+             * @param threads The number of threads, the calling thread is one of them.
+             */
+            void union_batch(const std::vector<std::pair<key, key>> &edges, const unsigned threads = 1) {
+                for (const auto &edge : edges) {
+                    is_in_bounds(edge.first);
+                    is_in_bounds(edge.second);
+                }
+
+                auto worker = [this, &edges, threads](const unsigned id) {
+                    const std::size_t chunk = (edges.size() + threads - 1) / threads;
+                    const std::size_t from = std::min(edges.size(), id * chunk);
+                    const std::size_t to = std::min(edges.size(), from + chunk);
+
+                    for (std::size_t i = from; i < to; ++i) {
+                        union_sets(edges[i].first, edges[i].second);
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                for (unsigned id = 1; id < threads; ++id) {
+                    workers.emplace_back(worker, id);
+                }
+
+                worker(0);
+                for (auto &w : workers) {
+                    w.join();
+                }
+            }
+
+            /**
+             * @return The number of sets inside the structure.
+             */
+            size_t number_of_sets() const {
+                return _s.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @return The number of elements inside the structure.
+             */
+            size_t size() const {
+                return n;
+            }
+
+        private:
+            void is_in_bounds(const key current) const {
+                if (current >= n) {
+                    throw std::out_of_range("Provided key is out of range.");
+                }
+            }
+
+            key n;
+            std::unique_ptr<std::atomic<key>[]> parent;
+            std::atomic<size_t> _s; // a number of sets in a structure
+        };
+    }
+}
+
+#endif //SRC_CONCURRENT_FIND_UNION_H
@@ -0,0 +1,280 @@
+#ifndef SRC_CONNECTED_COMPONENTS_H
+#define SRC_CONNECTED_COMPONENTS_H
+
+#include <string>
+#include <vector>
+#include <limits>
+#include <thread>
+#include <cstdint>
+#include <utility>
+#include <exception>
+#include <algorithm>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "dense_find_union.h"
+#include "concurrent_find_union.h"
+
+namespace algo_lib {
+    namespace disjoint_sets {
+        namespace detail {
+            /**
+             * A read only memory mapping of a whole file (POSIX only), unmapped by the destructor.
+             */
+            class mapped_file {
+            public:
+                explicit mapped_file(const std::string &path) {
+                    const int fd = ::open(path.c_str(), O_RDONLY);
+                    if (fd < 0) {
+                        throw std::runtime_error("Cannot open " + path + ".");
+                    }
+
+                    struct stat info{};
+                    if (::fstat(fd, &info) != 0) {
+                        ::close(fd);
+                        throw std::runtime_error("Cannot read the size of " + path + ".");
+                    }
+
+                    length = (std::size_t) info.st_size;
+                    if (length > 0) {
+                        void *mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if (mapping == MAP_FAILED) {
+                            ::close(fd);
+                            throw std::runtime_error("Cannot map " + path + ".");
+                        }
+
+                        // the pages are read once, front to back, so the kernel can drop them right after
+                        ::madvise(mapping, length, MADV_SEQUENTIAL);
+                        bytes = static_cast<const char *>(mapping);
+                    }
+
+                    ::close(fd);
+                }
+
+                mapped_file(const mapped_file &) = delete;
+                mapped_file &operator=(const mapped_file &) = delete;
+
+                ~mapped_file() {
+                    if (bytes != nullptr) {
+                        ::munmap(const_cast<char *>(bytes), length);
+                    }
+                }
+
+                const char *data() const noexcept {
+                    return bytes;
+                }
+
+                std::size_t size() const noexcept {
+                    return length;
+                }
+
+            private:
+                const char *bytes = nullptr;
+                std::size_t length = 0;
+            };
+        }
+
+        /**
+         * Formats of the edge files.
+         *  - binary: pairs of keys (in the native byte order and width of the key type), one after another,
+         *  - text: two decimal numbers per line separated by whitespace, blank lines and lines starting with '#'
+         *  are skipped, any other line makes connected_components throw std::invalid_argument.
+         */
+        enum class edge_format {
+            binary, text
+        };
+
+        /**
+         * The result of connected_components.
+         */
+        template<typename key>
+        struct components {
+            std::vector<key> labels; // a component of every vertex, numbered 0, 1, ... in the order of the first vertices
+            std::size_t count; // the number of components
+            std::size_t edges; // the number of edges read from a file
+        };
+
+        namespace detail {
+            constexpr std::size_t edge_batch = 4096; // edges parsed before they are merged, per worker
+
+            /**
+             * Parses [from, to) of a file and merges the edges into @sets in batches of edge_batch edges.
+             * @return the number of edges
+             */
+            template<typename key, typename sets_type>
+            std::size_t merge_chunk(const char *from, const char *to, const edge_format format, sets_type &sets) {
+                std::vector<std::pair<key, key>> batch;
+                batch.reserve(edge_batch);
+                std::size_t edges = 0;
+
+                auto flush = [&] {
+                    for (const auto &edge : batch) {
+                        sets.union_sets(edge.first, edge.second);
+                    }
+                    edges += batch.size();
+                    batch.clear();
+                };
+
+                if (format == edge_format::binary) {
+                    const key *values = reinterpret_cast<const key *>(from);
+                    const std::size_t pairs = (std::size_t) (to - from) / (2 * sizeof(key));
+
+                    for (std::size_t i = 0; i < pairs; ++i) {
+                        batch.push_back({values[2 * i], values[2 * i + 1]});
+                        if (batch.size() == edge_batch) {
+                            flush();
+                        }
+                    }
+                } else {
+                    auto skip_blanks = [&from, to] {
+                        while (from < to && (*from == ' ' || *from == '\t' || *from == '\r')) {
+                            ++from;
+                        }
+                    };
+
+                    auto number = [&from, to, &skip_blanks]() {
+                        skip_blanks();
+                        if (from == to || *from < '0' || *from > '9') {
+                            throw std::invalid_argument("An edge should consist of two vertices.");
+                        }
+
+                        constexpr std::uint64_t max = std::numeric_limits<key>::max();
+                        std::uint64_t parsed = 0;
+                        for (; from < to && *from >= '0' && *from <= '9'; ++from) {
+                            const auto digit = (std::uint64_t) (*from - '0');
+                            if (parsed > (max - digit) / 10) {
+                                throw std::out_of_range("Provided key is out of range.");
+                            }
+                            parsed = parsed * 10 + digit;
+                        }
+
+                        return (key) parsed;
+                    };
+
+                    while (from < to) {
+                        skip_blanks();
+
+                        if (from < to && *from == '#') {
+                            from = std::find(from, to, '\n');
+                        } else if (from < to && *from != '\n') {
+                            const key u = number();
+                            const key v = number();
+
+                            skip_blanks();
+                            if (from < to && *from != '\n') {
+                                throw std::invalid_argument("An edge should consist of two vertices.");
+                            }
+
+                            batch.push_back({u, v});
+                            if (batch.size() == edge_batch) {
+                                flush();
+                            }
+                        }
+
+                        if (from < to) {
+                            ++from;
+                        }
+                    }
+                }
+
+                flush();
+
+                return edges;
+            }
+        }
+
+        /**
+         * @brief Computes the connected components of a graph stored in an edge file.
+         * @param path a path of the edge file, it is memory mapped, not read into memory
+         * @param n the number of vertices, vertices are 0, 1, ..., n - 1
+         * @param format binary or text, see edge_format
+         * @param threads the number of workers, the file is split into this many chunks
+         * @return labels of the vertices, the number of components and the number of edges
+         *
+         * Besides the mapping (whose pages are dropped by the kernel whenever it needs memory),
+         * the memory used is O(n + threads * edge_batch) regardless of the number of edges.
+         * A single worker merges the edges into a dense_find_union, more of them share a concurrent_find_union.
+         */
+        template<typename key = std::uint32_t>
+        components<key> connected_components(const std::string &path, const key n,
+                                             const edge_format format = edge_format::binary,
+                                             const unsigned threads = 1) {
+            detail::mapped_file file(path);
+            const char *begin = file.data(), *end = file.data() + file.size();
+
+            if (format == edge_format::binary && file.size() % (2 * sizeof(key)) != 0) {
+                throw std::invalid_argument("Size of a binary edge file should be a multiple of the edge size.");
+            }
+
+            // chunk boundaries, moved to the beginnings of records
+            std::vector<const char *> bounds{begin};
+            for (unsigned chunk = 1; chunk < std::max(1u, threads); ++chunk) {
+                const char *bound = begin + file.size() / threads * chunk;
+
+                if (format == edge_format::binary) {
+                    bound = begin + (std::size_t) (bound - begin) / (2 * sizeof(key)) * (2 * sizeof(key));
+                } else {
+                    bound = std::find(std::max(bound - 1, begin), end, '\n');
+                    bound = bound < end ? bound + 1 : end;
+                }
+
+                bounds.push_back(std::max(bound, bounds.back()));
+            }
+            bounds.push_back(end);
+
+            components<key> result{std::vector<key>(n), 0, 0};
+            auto label = [&result, n](auto &sets) {
+                const key none = std::numeric_limits<key>::max();
+                std::vector<key> component(n, none);
+
+                for (key vertex = 0; vertex < n; ++vertex) {
+                    key &root_label = component[sets.find(vertex)];
+                    if (root_label == none) {
+                        root_label = (key) result.count++;
+                    }
+                    result.labels[vertex] = root_label;
+                }
+            };
+
+            if (threads <= 1) {
+                dense_find_union<key> sets(n);
+                result.edges = detail::merge_chunk<key>(begin, end, format, sets);
+                label(sets);
+
+                return result;
+            }
+
+            concurrent_find_union<key> sets(n);
+            std::vector<std::size_t> edges(threads, 0);
+            std::vector<std::exception_ptr> errors(threads);
+
+            std::vector<std::thread> workers;
+            for (unsigned id = 0; id < threads; ++id) {
+                workers.emplace_back([&, id] {
+                    try {
+                        edges[id] = detail::merge_chunk<key>(bounds[id], bounds[id + 1], format, sets);
+                    } catch (...) {
+                        errors[id] = std::current_exception();
+                    }
+                });
+            }
+            for (auto &w : workers) {
+                w.join();
+            }
+
+            for (unsigned id = 0; id < threads; ++id) {
+                if (errors[id]) {
+                    std::rethrow_exception(errors[id]);
+                }
+                result.edges += edges[id];
+            }
+            label(sets);
+
+            return result;
+        }
+    }
+}
+
+#endif //SRC_CONNECTED_COMPONENTS_H
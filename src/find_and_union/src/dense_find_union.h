@@ -0,0 +1,155 @@
+#ifndef SRC_DENSE_FIND_UNION_H
+#define SRC_DENSE_FIND_UNION_H
+
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace algo_lib {
+    namespace disjoint_sets {
+
+        /**
+         * A find_union structure for the keys 0, 1, ..., n - 1, kept in a single flat array, without hashing.
+         * @tparam key an unsigned integer type of keys, f.e. uint32_t takes 4 bytes per element
+         *
+         * Every element keeps one signed number: the parent of a non-root element, or minus the size
+         * of the set for a root, so union by size needs no separate rank table.
+         * Find uses path halving (every element on the path is linked to its grandparent),
+         * which is iterative and needs a single pass, so the operations take amortised O(alpha(n)) time.
+         */
+        template<typename key = unsigned>
+        class dense_find_union {
+            static_assert(std::is_integral<key>::value && std::is_unsigned<key>::value,
+                          "Keys of a dense find_union should be unsigned integers.");
+
+            using link = typename std::make_signed<key>::type;
+
+        public:
+            /**
+             * @brief Creates an %dense_find_union structure with @n singletons: 0, 1, ..., n - 1.
+             */
+            explicit dense_find_union(const key n = 0)
+                    : _s(n) {
+                if (n > (key) std::numeric_limits<link>::max()) {
+                    throw std::length_error("Size of a structure is out of the supported range.");
+                }
+
+                parent.assign(n, -1);
+            }
+
+            /**
+             * @brief Adds a new singleton set.
+             * @return A key of the new element, the next unused integer.
+             */
+            key add() {
+                if (parent.size() >= (std::size_t) std::numeric_limits<link>::max()) {
+                    throw std::length_error("Size of a structure is out of the supported range.");
+                }
+
+                parent.push_back(-1);
+                _s++;
+
+                return (key) (parent.size() - 1);
+            }
+
+            /**
+             * @brief Finds an id of a set @current element is in.
+             * @param current An id of an element to find.
+             * @return An id of the set @current element is in.
+             */
+            key find(key current) {
+                is_in_bounds(current);
+
+                while (parent[current] >= 0) {
+                    const link grandparent = parent[parent[current]];
+                    if (grandparent >= 0) {
+                        parent[current] = grandparent;
+                    }
+                    current = (key) parent[current];
+                }
+
+                return current;
+            }
+
+            /**
+             * @brief The same as find, path halving is iterative already.
+             */
+            key iterative_find(const key current) {
+                return find(current);
+            }
+
+            /**
+             * Merges two sets into one, the smaller one is attached to the bigger one.
+             * @param first First set to merge.
+             * @param second Second set to merge.
+             */
+            void union_sets(const key first, const key second) {
+                key first_root = find(first);
+                key second_root = find(second);
+
+                if (first_root == second_root) {
+                    return;
+                }
+
+                // sizes are negative, so the bigger set has the lower value
+                if (parent[first_root] > parent[second_root]) {
+                    std::swap(first_root, second_root);
+                }
+
+                parent[first_root] += parent[second_root];
+                parent[second_root] = (link) first_root;
+
+                _s--;
+            }
+
+            /**
+             * @brief The same as union_sets.
+             */
+            void iterative_union(const key first, const key second) {
+                union_sets(first, second);
+            }
+
+            /**
+             * @brief Checks whether the given elements are inside the same set.
+             * @return True if the root of both is the same, false otherwise.
+             */
+            bool equal(const key first, const key second) {
+                return find(first) == find(second);
+            }
+
+            /**
+             * @return The number of elements in the set @current element is in.
+             */
+            std::size_t set_size(const key current) {
+                return (std::size_t) -parent[find(current)];
+            }
+
+            /**
+             * @return The number of sets inside the structure.
+             */
+            size_t number_of_sets() const {
+                return _s;
+            }
+
+            /**
+             * @return The number of elements inside the structure.
+             */
+            size_t size() const {
+                return parent.size();
+            }
+
+        private:
+            void is_in_bounds(const key current) const {
+                if (current >= parent.size()) {
+                    throw std::out_of_range("Provided key is out of range.");
+                }
+            }
+
+            std::vector<link> parent; // a parent of an element, or minus the size of a set for a root
+            size_t _s; // a number of sets in a structure
+        };
+    }
+}
+
+#endif //SRC_DENSE_FIND_UNION_H
@@ -0,0 +1,161 @@
+#ifndef SRC_DYNAMIC_CONNECTIVITY_H
+#define SRC_DYNAMIC_CONNECTIVITY_H
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include "rollback_find_union.h"
+
+namespace algo_lib {
+    namespace disjoint_sets {
+
+        /**
+         * Offline dynamic connectivity: records a log of edge insertions, deletions and connectivity
+         * queries over the vertices 0, 1, ..., n - 1 and answers all of the queries at once.
+         * @tparam key an unsigned integer type of vertices
+         *
+         * Every edge is alive during an interval of the query times. The intervals are put into
+         * a segment tree over the times (each of them into O(log(q)) nodes), and a depth first traversal
+         * of the tree adds the edges of a node to a rollback_find_union, answers the queries in the leafs
+         * and rolls the unions back when it leaves the node.
+         * It takes O((n + q + m * log(q)) * log(n)) time, where m is the number of edge insertions.
+         */
+        template<typename key = unsigned>
+        class dynamic_connectivity {
+        public:
+            using edge = std::pair<key, key>;
+
+            explicit dynamic_connectivity(const key n)
+                    : n(n) {}
+
+            /**
+             * @brief Records an insertion of the edge (u, v), parallel edges are allowed.
+             */
+            void add_edge(const key u, const key v) {
+                is_in_bounds(u);
+                is_in_bounds(v);
+
+                alive[normalize(u, v)].push_back(queries.size());
+            }
+
+            /**
+             * @brief Records a deletion of one copy of the edge (u, v), which has to be present.
+             */
+            void remove_edge(const key u, const key v) {
+                const auto it = alive.find(normalize(u, v));
+                if (it == alive.end()) {
+                    throw std::invalid_argument("Provided edge does not exist.");
+                }
+
+                intervals.push_back({it->second.back(), queries.size(), it->first});
+                it->second.pop_back();
+                if (it->second.empty()) {
+                    alive.erase(it);
+                }
+            }
+
+            /**
+             * @brief Records a query whether u and v are connected at this moment.
+             * @return An index of the query in the result of solve().
+             */
+            std::size_t connected(const key u, const key v) {
+                is_in_bounds(u);
+                is_in_bounds(v);
+
+                queries.push_back({u, v});
+
+                return queries.size() - 1;
+            }
+
+            /**
+             * @return Answers to all of the recorded queries, in order.
+             */
+            std::vector<bool> solve() const {
+                std::vector<bool> answers(queries.size());
+                if (queries.empty()) {
+                    return answers;
+                }
+
+                std::vector<std::vector<edge>> tree(4 * queries.size());
+                auto insert = [&](const interval &i) {
+                    if (i.from < i.to) {
+                        insert_interval(tree, 1, 0, queries.size(), i);
+                    }
+                };
+
+                for (const auto &i : intervals) {
+                    insert(i);
+                }
+                for (const auto &open : alive) {
+                    for (const std::size_t from : open.second) {
+                        insert({from, queries.size(), open.first});
+                    }
+                }
+
+                rollback_find_union<key> sets(n);
+                traverse(tree, sets, answers, 1, 0, queries.size());
+
+                return answers;
+            }
+
+        private:
+            struct interval {
+                std::size_t from, to; // [from, to) in the query times
+                edge e;
+            };
+
+            static edge normalize(const key u, const key v) {
+                return u < v ? edge{u, v} : edge{v, u};
+            }
+
+            static void insert_interval(std::vector<std::vector<edge>> &tree, const std::size_t node,
+                                        const std::size_t left, const std::size_t right, const interval &i) {
+                if (i.to <= left || right <= i.from) {
+                    return;
+                }
+
+                if (i.from <= left && right <= i.to) {
+                    tree[node].push_back(i.e);
+                    return;
+                }
+
+                const std::size_t middle = (left + right) / 2;
+                insert_interval(tree, 2 * node, left, middle, i);
+                insert_interval(tree, 2 * node + 1, middle, right, i);
+            }
+
+            void traverse(const std::vector<std::vector<edge>> &tree, rollback_find_union<key> &sets,
+                          std::vector<bool> &answers, const std::size_t node,
+                          const std::size_t left, const std::size_t right) const {
+                const auto state = sets.snapshot();
+                for (const auto &e : tree[node]) {
+                    sets.union_sets(e.first, e.second);
+                }
+
+                if (right - left == 1) {
+                    answers[left] = sets.equal(queries[left].first, queries[left].second);
+                } else {
+                    const std::size_t middle = (left + right) / 2;
+                    traverse(tree, sets, answers, 2 * node, left, middle);
+                    traverse(tree, sets, answers, 2 * node + 1, middle, right);
+                }
+
+                sets.rollback(state);
+            }
+
+            void is_in_bounds(const key vertex) const {
+                if (vertex >= n) {
+                    throw std::out_of_range("Provided key is out of range.");
+                }
+            }
+
+            key n;
+            std::vector<edge> queries;
+            std::vector<interval> intervals; // edges which have been removed already
+            std::map<edge, std::vector<std::size_t>> alive; // insertion times of the edges which are still present
+        };
+    }
+}
+
+#endif //SRC_DYNAMIC_CONNECTIVITY_H
@@ -1,6 +1,8 @@
 #ifndef SRC_FIND_UNION_H
 #define SRC_FIND_UNION_H
 
+#include <stdexcept>
+#include <functional>
 #include <unordered_map>
 #include <vector>
 
@@ -13,8 +15,15 @@ namespace algo_lib {
          * algorithm for find operation. Consequently achieving O(const) for every operation
          * (technically speaking it is not a lie, but to be honest it is O(alpha(n), whose values
          * are usually less than 5 ~ 6 for the given data)
+         *
+         * Members of every set are linked into a circular list (merging two lists is a swap of two successors),
+         * and every root keeps the size and an aggregate of its set, so the members can be listed in O(|set|)
+         * and the size or the aggregate can be read in O(alpha(n)).
+         * @tparam key a type of elements
+         * @tparam value a type of the per-set aggregates
+         * @tparam combiner an associative and commutative functor, merging the aggregates of two sets
           */
-        template<typename key>
+        template<typename key, typename value = std::size_t, typename combiner = std::plus<value>>
         class find_union {
         public:
             /**
@@ -32,8 +41,7 @@ namespace algo_lib {
             find_union(const IterativeContainer& keys)
                     : _s(keys.size()) {
                 for (const auto& k: keys) {
-                    parent.insert({k, k});
-                    rank.insert({k, 0ULL});
+                    make_set(k);
                 }
             }
 
@@ -47,8 +55,7 @@ namespace algo_lib {
                 size_t s = 0;
 
                 for (InputIterator it = b; it != e; ++it) {
-                    parent.insert({*it, *it});
-                    rank.insert({*it, 0ULL});
+                    make_set(*it);
                     ++s;
                 }
 
@@ -68,8 +75,7 @@ namespace algo_lib {
                 }
 
                 for (const auto& k: keys) {
-                    parent.insert({k, k});
-                    rank.insert({k, 0ULL});
+                    make_set(k);
                     _s++;
                 }
 
@@ -90,7 +96,7 @@ namespace algo_lib {
                 }
 
                 for (const auto& k: keys) {
-                    union_sets(keys, parent);
+                    union_sets(k, parent);
                 }
 
                 return true;
@@ -123,11 +129,12 @@ namespace algo_lib {
              * @return An id of the set @current element is in.
              */
             key find(const key current) {
-                if (current != parent.at(current)) {
-                    parent[current] = find(parent[current]);
+                node &n = nodes.at(current);
+                if (current != n.parent) {
+                    n.parent = find(n.parent);
                 }
 
-                return parent[current];
+                return n.parent;
             }
 
             /**
@@ -138,7 +145,7 @@ namespace algo_lib {
             void union_sets(const key first, const key second) {
                 _union_sets(first,
                             second,
-                            std::bind(&find_union<key>::find, this, std::placeholders::_1));
+                            std::bind(&find_union::find, this, std::placeholders::_1));
             }
 
             /**
@@ -156,14 +163,15 @@ namespace algo_lib {
                 key dup = current;
 
                 // traverses the path to find a root
-                while (dup != parent.at(dup)) {
-                    dup = parent.at(dup);
+                while (dup != nodes.at(dup).parent) {
+                    dup = nodes.at(dup).parent;
                 }
 
-                // every parent on the node on that path becomes the root
+                // every node on that path gets the root as its parent
                 while (current != dup) {
-                    current = parent[current];
-                    parent[current] = dup;
+                    node &n = nodes.at(current);
+                    current = n.parent;
+                    n.parent = dup;
                 }
 
                 return dup;
@@ -180,7 +188,7 @@ namespace algo_lib {
             void iterative_union(const key first, const key second) {
                 _union_sets(first,
                             second,
-                            std::bind(&find_union<key>::iterative_find, this, std::placeholders::_1));
+                            std::bind(&find_union::iterative_find, this, std::placeholders::_1));
             }
 
             /**
@@ -200,7 +208,64 @@ namespace algo_lib {
                 return _s;
             }
 
+            /**
+             * @param current An element of a set.
+             * @return The number of elements in the set @current element is in.
+             */
+            size_t set_size(const key current) {
+                return nodes.at(iterative_find(current)).size;
+            }
+
+            /**
+             * @param current An element of a set.
+             * @return The aggregate of the set @current element is in, value() for a new singleton.
+             */
+            value aggregate(const key current) {
+                return nodes.at(iterative_find(current)).aggregate;
+            }
+
+            /**
+             * @brief Combines @v into the aggregate of the set @current element is in.
+             */
+            void combine_into(const key current, const value v) {
+                auto &slot = nodes.at(iterative_find(current)).aggregate;
+                slot = merge(slot, v);
+            }
+
+            /**
+             * @brief Calls @fn for every element of the set @current element is in, in O(|set|) time.
+             */
+            template<typename Fn>
+            void for_each_member(const key current, Fn fn) const {
+                if (nodes.count(current) == 0) {
+                    throw std::out_of_range("Provided key does not exist.");
+                }
+
+                key member = current;
+                do {
+                    fn(member);
+                    member = nodes.find(member)->second.successor;
+                } while (member != current);
+            }
+
+            /**
+             * @return All of the elements of the set @current element is in.
+             */
+            std::vector<key> members(const key current) const {
+                std::vector<key> result;
+                for_each_member(current, [&result](const key member) { result.push_back(member); });
+
+                return result;
+            }
+
         private:
+            /**
+             * @brief Makes a singleton set from @k.
+             */
+            void make_set(const key k) {
+                nodes.insert({k, node{k, k, 0ULL, 1, value()}});
+            }
+
             /**
              * @brief Checks whether any of the keys exists in a structure.
              * @param keys Any container that supports ranges iteration.
@@ -209,7 +274,7 @@ namespace algo_lib {
             template<typename IterativeContainer>
             bool exists_any(const IterativeContainer& keys) {
                 for (const auto k: keys) {
-                    if (parent.count(k) > 0) {
+                    if (nodes.count(k) > 0) {
                         return true;
                     }
                 }
@@ -233,20 +298,40 @@ namespace algo_lib {
                     return;
                 }
 
-                if (rank.at(first_root) < rank.at(second_root)) {
+                node *root = &nodes.at(first_root);
+                node *child = &nodes.at(second_root);
+                if (root->rank < child->rank) {
+                    std::swap(root, child);
                     std::swap(first_root, second_root);
                 }
 
-                parent[second_root] = first_root;
-                if (rank.at(first_root) == rank.at(second_root)) {
-                    ++rank[first_root];
+                child->parent = first_root;
+                if (root->rank == child->rank) {
+                    ++root->rank;
                 }
 
+                // splices two circular lists into one
+                std::swap(root->successor, child->successor);
+
+                root->size += child->size;
+                root->aggregate = merge(root->aggregate, child->aggregate);
+
                 _s--;
             }
 
-            std::unordered_map<key, key> parent;
-            std::unordered_map<key, unsigned long long> rank;
+            /**
+             * Everything kept for a key, in a single record, so a step of find or union hashes a key once.
+             */
+            struct node {
+                key parent;
+                key successor; // the next element of the same set, a circular list
+                unsigned long long rank;
+                size_t size; // valid for roots only
+                value aggregate; // valid for roots only
+            };
+
+            std::unordered_map<key, node> nodes;
+            combiner merge;
             size_t _s; // a number of sets in a structure
         };
     }
@@ -0,0 +1,149 @@
+#ifndef SRC_ROLLBACK_FIND_UNION_H
+#define SRC_ROLLBACK_FIND_UNION_H
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace algo_lib {
+    namespace disjoint_sets {
+
+        /**
+         * A find_union structure for the keys 0, 1, ..., n - 1, whose unions can be undone.
+         * @tparam key an unsigned integer type of keys
+         *
+         * It uses union by rank only, without path compression, so a find takes O(log(n)) time
+         * and a union changes at most two entries, which are recorded on an undo stack.
+         * snapshot() returns the current height of the stack and rollback(snapshot) undoes
+         * every union made after it, k unions are undone in O(k) time.
+         */
+        template<typename key = unsigned>
+        class rollback_find_union {
+            static_assert(std::is_integral<key>::value && std::is_unsigned<key>::value,
+                          "Keys of a rollback find_union should be unsigned integers.");
+
+        public:
+            using snapshot_type = std::size_t;
+
+            /**
+             * @brief Creates an %rollback_find_union structure with @n singletons: 0, 1, ..., n - 1.
+             */
+            explicit rollback_find_union(const key n = 0)
+                    : parent(n), rank(n, 0), _s(n) {
+                for (key k = 0; k < n; ++k) {
+                    parent[k] = k;
+                }
+            }
+
+            /**
+             * @brief Finds an id of a set @current element is in, does not change the structure.
+             */
+            key find(key current) const {
+                is_in_bounds(current);
+
+                while (parent[current] != current) {
+                    current = parent[current];
+                }
+
+                return current;
+            }
+
+            /**
+             * Merges two sets into one, the merge is recorded on the undo stack.
+             * @param first First set to merge.
+             * @param second Second set to merge.
+             * @return True if the sets were different, false otherwise (nothing is recorded then).
+             */
+            bool union_sets(const key first, const key second) {
+                key first_root = find(first);
+                key second_root = find(second);
+
+                if (first_root == second_root) {
+                    return false;
+                }
+
+                if (rank[first_root] < rank[second_root]) {
+                    std::swap(first_root, second_root);
+                }
+
+                const bool rank_increased = rank[first_root] == rank[second_root];
+                parent[second_root] = first_root;
+                if (rank_increased) {
+                    ++rank[first_root];
+                }
+
+                history.push_back({second_root, rank_increased});
+                _s--;
+
+                return true;
+            }
+
+            /**
+             * @brief Checks whether the given elements are inside the same set.
+             */
+            bool equal(const key first, const key second) const {
+                return find(first) == find(second);
+            }
+
+            /**
+             * @return A state which can be restored with rollback.
+             */
+            snapshot_type snapshot() const noexcept {
+                return history.size();
+            }
+
+            /**
+             * @brief Undoes all of the unions made after the @state was taken.
+             */
+            void rollback(const snapshot_type state) {
+                if (state > history.size()) {
+                    throw std::out_of_range("Provided snapshot is newer than the structure.");
+                }
+
+                while (history.size() > state) {
+                    const auto &last = history.back();
+                    const key child = last.first;
+                    const key root = parent[child];
+
+                    if (last.second) {
+                        --rank[root];
+                    }
+                    parent[child] = child;
+
+                    history.pop_back();
+                    _s++;
+                }
+            }
+
+            /**
+             * @return The number of sets inside the structure.
+             */
+            size_t number_of_sets() const {
+                return _s;
+            }
+
+            /**
+             * @return The number of elements inside the structure.
+             */
+            size_t size() const {
+                return parent.size();
+            }
+
+        private:
+            void is_in_bounds(const key current) const {
+                if (current >= parent.size()) {
+                    throw std::out_of_range("Provided key is out of range.");
+                }
+            }
+
+            std::vector<key> parent;
+            std::vector<std::uint8_t> rank; // ranks do not exceed log2(n)
+            std::vector<std::pair<key, bool>> history; // a root which got a parent, and whether the new root's rank grew
+            size_t _s; // a number of sets in a structure
+        };
+    }
+}
+
+#endif //SRC_ROLLBACK_FIND_UNION_H
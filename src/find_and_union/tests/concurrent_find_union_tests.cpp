@@ -0,0 +1,62 @@
+#define BOOST_TEST_MODULE concurrent_find_union_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <thread>
+#include "../src/dense_find_union.h"
+#include "../src/concurrent_find_union.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(simple_test_case) {
+        algo_lib::disjoint_sets::concurrent_find_union<> sets(10);
+
+        BOOST_CHECK(sets.union_sets(1, 2));
+        BOOST_CHECK(sets.union_sets(2, 7));
+        BOOST_CHECK(!sets.union_sets(7, 1));
+
+        BOOST_CHECK(sets.equal(1, 7));
+        BOOST_CHECK(!sets.equal(0, 7));
+        BOOST_CHECK_EQUAL(sets.number_of_sets(), 8);
+        BOOST_CHECK_THROW(sets.find(10), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_batch_against_dense) {
+        constexpr unsigned SIZE = 20000, EDGES = 15000;
+
+        std::mt19937 gen(19);
+        std::vector<std::pair<unsigned, unsigned>> edges(EDGES);
+        for (auto &edge : edges) {
+            edge = {gen() % SIZE, gen() % SIZE};
+        }
+
+        algo_lib::disjoint_sets::dense_find_union<> expected(SIZE);
+        for (const auto &edge : edges) {
+            expected.union_sets(edge.first, edge.second);
+        }
+
+        for (unsigned threads : {1u, 4u}) {
+            algo_lib::disjoint_sets::concurrent_find_union<> sets(SIZE);
+
+            // the queries go along with the unions, afterwards the partition has to be exact
+            std::atomic<bool> done{false};
+            std::thread reader([&] {
+                std::mt19937 query_gen(threads);
+                while (!done) {
+                    sets.equal(query_gen() % SIZE, query_gen() % SIZE);
+                }
+            });
+
+            sets.union_batch(edges, threads);
+            done = true;
+            reader.join();
+
+            BOOST_CHECK_EQUAL(sets.number_of_sets(), expected.number_of_sets());
+            for (unsigned i = 0; i < 2000; ++i) {
+                const unsigned a = gen() % SIZE, b = gen() % SIZE;
+                BOOST_CHECK_EQUAL(sets.equal(a, b), expected.equal(a, b));
+            }
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
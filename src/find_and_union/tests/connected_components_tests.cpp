@@ -0,0 +1,84 @@
+#define BOOST_TEST_MODULE connected_components_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <cstdio>
+#include <fstream>
+#include "../src/connected_components.h"
+
+namespace sets = algo_lib::disjoint_sets;
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(text_file) {
+        const std::string path = "connected_components_test.txt";
+        {
+            std::ofstream out(path);
+            out << "# a comment\n0 1\n2\t3\r\n\n1 4\n5 5\n3 6";
+        }
+
+        for (unsigned threads : {1u, 2u, 5u}) {
+            const auto result = sets::connected_components<std::uint32_t>(path, 8, sets::edge_format::text, threads);
+
+            BOOST_CHECK_EQUAL(result.edges, 5);
+            BOOST_CHECK_EQUAL(result.count, 4);
+            BOOST_CHECK((result.labels == std::vector<std::uint32_t>{0, 0, 1, 1, 0, 2, 1, 3}));
+        }
+
+        std::remove(path.c_str());
+        BOOST_CHECK_THROW(sets::connected_components<std::uint32_t>(path, 8), std::runtime_error);
+    }
+
+    BOOST_AUTO_TEST_CASE(malformed_text_file) {
+        const std::string path = "connected_components_malformed.txt";
+        auto components_of = [&path](const std::string &contents) {
+            {
+                std::ofstream out(path);
+                out << contents;
+            }
+            return sets::connected_components<std::uint64_t>(path, 4, sets::edge_format::text);
+        };
+
+        BOOST_CHECK_EQUAL(components_of("  # indented comment\n \t\n0 1 \r\n").edges, 1);
+        BOOST_CHECK_THROW(components_of("0 1\nabc 1\n"), std::invalid_argument);
+        BOOST_CHECK_THROW(components_of("1 2 x\n"), std::invalid_argument);
+        BOOST_CHECK_THROW(components_of("1 2 3\n"), std::invalid_argument);
+        BOOST_CHECK_THROW(components_of("1\n"), std::invalid_argument);
+        // 2^64 + 1 would wrap around to 1
+        BOOST_CHECK_THROW(components_of("18446744073709551617 0\n"), std::out_of_range);
+        BOOST_CHECK_THROW(components_of("100000000000000000000 0\n"), std::out_of_range);
+
+        std::remove(path.c_str());
+    }
+
+    BOOST_AUTO_TEST_CASE(binary_file_against_dense) {
+        constexpr std::uint32_t SIZE = 5000, EDGES = 4000;
+        const std::string path = "connected_components_test.bin";
+
+        std::mt19937 gen(22);
+        sets::dense_find_union<std::uint32_t> expected(SIZE);
+        {
+            std::ofstream out(path, std::ios::binary);
+            for (std::uint32_t i = 0; i < EDGES; ++i) {
+                const std::uint32_t edge[2] = {(std::uint32_t) (gen() % SIZE), (std::uint32_t) (gen() % SIZE)};
+                out.write(reinterpret_cast<const char *>(edge), sizeof(edge));
+                expected.union_sets(edge[0], edge[1]);
+            }
+        }
+
+        for (unsigned threads : {1u, 3u}) {
+            const auto result = sets::connected_components<std::uint32_t>(path, SIZE, sets::edge_format::binary, threads);
+
+            BOOST_CHECK_EQUAL(result.edges, EDGES);
+            BOOST_CHECK_EQUAL(result.count, expected.number_of_sets());
+            for (std::uint32_t i = 0; i < 1000; ++i) {
+                const std::uint32_t a = gen() % SIZE, b = gen() % SIZE;
+                BOOST_CHECK_EQUAL(result.labels[a] == result.labels[b], expected.equal(a, b));
+            }
+        }
+
+        BOOST_CHECK_THROW(sets::connected_components<std::uint32_t>(path, 10), std::out_of_range);
+        std::remove(path.c_str());
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,59 @@
+#define BOOST_TEST_MODULE dense_find_union_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <numeric>
+#include "../src/find_union.h"
+#include "../src/dense_find_union.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(simple_test_case) {
+        using union_set_type = algo_lib::disjoint_sets::dense_find_union<>;
+        constexpr unsigned SIZE = 100;
+        union_set_type sets(SIZE);
+
+        for (unsigned i = 0; i < SIZE - 1; i += 2) {
+            sets.union_sets(i, i + 1);
+        }
+        BOOST_CHECK_EQUAL(sets.number_of_sets(), SIZE / 2);
+
+        for (unsigned i = 0; i < SIZE - 1; ++i) {
+            sets.union_sets(i, i + 1);
+        }
+
+        auto compare = sets.find(0);
+        for (unsigned i = 0; i < SIZE; ++i) {
+            BOOST_CHECK_EQUAL(sets.find(i), compare);
+        }
+        BOOST_CHECK_EQUAL(sets.number_of_sets(), 1);
+        BOOST_CHECK_EQUAL(sets.set_size(17), SIZE);
+
+        BOOST_CHECK_EQUAL(sets.add(), SIZE);
+        BOOST_CHECK(!sets.equal(0, SIZE));
+        BOOST_CHECK_THROW(sets.find(SIZE + 1), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(against_map_based) {
+        constexpr unsigned SIZE = 1000;
+        std::vector<unsigned> keys(SIZE);
+        std::iota(keys.begin(), keys.end(), 0);
+
+        algo_lib::disjoint_sets::find_union<unsigned> map_based(keys);
+        algo_lib::disjoint_sets::dense_find_union<unsigned short> dense(SIZE);
+
+        std::mt19937 gen(18);
+        for (int step = 0; step < 5000; ++step) {
+            const unsigned a = gen() % SIZE, b = gen() % SIZE;
+
+            if (step % 3) {
+                BOOST_CHECK_EQUAL(dense.equal(a, b), map_based.equal(a, b));
+            } else {
+                map_based.union_sets(a, b);
+                dense.union_sets(a, b);
+                BOOST_CHECK_EQUAL(dense.number_of_sets(), map_based.number_of_sets());
+            }
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,64 @@
+#define BOOST_TEST_MODULE dynamic_connectivity_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <set>
+#include "../src/dense_find_union.h"
+#include "../src/dynamic_connectivity.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(simple_test_case) {
+        algo_lib::disjoint_sets::dynamic_connectivity<> log(4);
+
+        log.add_edge(0, 1);
+        log.add_edge(1, 2);
+        log.connected(0, 2);
+        log.remove_edge(2, 1);
+        log.connected(0, 2);
+        log.add_edge(1, 2);
+        log.add_edge(2, 1);
+        log.remove_edge(1, 2);
+        log.connected(2, 0);
+        log.connected(3, 3);
+        log.connected(0, 3);
+
+        BOOST_CHECK((log.solve() == std::vector<bool>{true, false, true, true, false}));
+        BOOST_CHECK_THROW(log.remove_edge(0, 3), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(against_recomputation) {
+        constexpr unsigned SIZE = 30;
+        algo_lib::disjoint_sets::dynamic_connectivity<> log(SIZE);
+        std::multiset<std::pair<unsigned, unsigned>> edges;
+        std::vector<bool> expected;
+
+        std::mt19937 gen(20);
+        for (int step = 0; step < 600; ++step) {
+            const unsigned operation = gen() % 3;
+
+            if (operation == 0 || edges.empty()) {
+                const unsigned u = gen() % SIZE, v = gen() % SIZE;
+                log.add_edge(u, v);
+                edges.insert({std::min(u, v), std::max(u, v)});
+            } else if (operation == 1) {
+                auto it = edges.begin();
+                std::advance(it, gen() % edges.size());
+                log.remove_edge(it->second, it->first);
+                edges.erase(it);
+            } else {
+                const unsigned u = gen() % SIZE, v = gen() % SIZE;
+                log.connected(u, v);
+
+                algo_lib::disjoint_sets::dense_find_union<> sets(SIZE);
+                for (const auto &e : edges) {
+                    sets.union_sets(e.first, e.second);
+                }
+                expected.push_back(sets.equal(u, v));
+            }
+        }
+
+        BOOST_CHECK(log.solve() == expected);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -1,6 +1,7 @@
 #define BOOST_TEST_MODULE find_union_tests
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/execution_monitor.hpp>
+#include <algorithm>
 #include "../src/find_union.h"
 
 BOOST_AUTO_TEST_SUITE(simple);
@@ -23,4 +24,44 @@ BOOST_AUTO_TEST_SUITE(simple);
         }
     }
 
+    BOOST_AUTO_TEST_CASE(members_and_aggregates) {
+        struct maximum {
+            int operator()(const int lhs, const int rhs) const {
+                return std::max(lhs, rhs);
+            }
+        };
+        using union_set_type = algo_lib::disjoint_sets::find_union<int, int, maximum>;
+
+        std::vector<int> keys{1, 2, 3, 4, 5, 6};
+        union_set_type sets(keys);
+        for (const int k : keys) {
+            sets.combine_into(k, k * 10);
+        }
+
+        sets.union_sets(1, 3);
+        sets.iterative_union(5, 3);
+        sets.union_sets(2, 4);
+        sets.add(7);
+
+        auto members = sets.members(3);
+        std::sort(members.begin(), members.end());
+        BOOST_CHECK((members == std::vector<int>{1, 3, 5}));
+        BOOST_CHECK_EQUAL(sets.set_size(1), 3);
+        BOOST_CHECK_EQUAL(sets.aggregate(1), 50);
+        BOOST_CHECK_EQUAL(sets.aggregate(4), 40);
+        BOOST_CHECK_EQUAL(sets.set_size(7), 1);
+        BOOST_CHECK_EQUAL(sets.aggregate(7), 0);
+
+        sets.union_sets(4, 5);
+        sets.combine_into(2, 100);
+        BOOST_CHECK_EQUAL(sets.set_size(3), 5);
+        BOOST_CHECK_EQUAL(sets.aggregate(1), 100);
+        BOOST_CHECK_EQUAL(sets.members(6).size(), 1);
+        BOOST_CHECK_EQUAL(sets.number_of_sets(), 3);
+
+        int visited = 0;
+        BOOST_CHECK_THROW(sets.for_each_member(8, [&visited](int) { ++visited; }), std::out_of_range);
+        BOOST_CHECK_EQUAL(visited, 0);
+    }
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
@@ -0,0 +1,32 @@
+#define BOOST_TEST_MODULE rollback_find_union_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include "../src/rollback_find_union.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(simple_test_case) {
+        algo_lib::disjoint_sets::rollback_find_union<> sets(10);
+
+        sets.union_sets(0, 1);
+        const auto state = sets.snapshot();
+
+        BOOST_CHECK(sets.union_sets(1, 2));
+        BOOST_CHECK(sets.union_sets(3, 4));
+        BOOST_CHECK(sets.union_sets(4, 0));
+        BOOST_CHECK(!sets.union_sets(2, 3));
+        BOOST_CHECK(sets.equal(2, 3));
+        BOOST_CHECK_EQUAL(sets.number_of_sets(), 6);
+
+        sets.rollback(state);
+        BOOST_CHECK(sets.equal(0, 1));
+        BOOST_CHECK(!sets.equal(1, 2));
+        BOOST_CHECK(!sets.equal(3, 4));
+        BOOST_CHECK_EQUAL(sets.number_of_sets(), 9);
+        BOOST_CHECK_THROW(sets.rollback(state + 1), std::out_of_range);
+
+        sets.rollback(0);
+        BOOST_CHECK_EQUAL(sets.number_of_sets(), 10);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,43 @@
+#include <chrono>
+#include <random>
+#include "../src/monoid_segment_tree.h"
+
+/*
+ * Compares applying a batch of leaf updates one by one with apply_batch.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 -pthread apply_batch_benchmark.cpp
+ */
+
+constexpr unsigned long SIZE = 1UL << 22;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    using Tree = algo_lib::tree::monoid_segment_tree<long long>;
+    std::mt19937_64 gen(42);
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned long batch : {100UL, 100000UL, 1000000UL}) {
+        std::vector<std::pair<unsigned long, long long>> updates(batch);
+        for (auto &update : updates) {
+            update = {gen() % SIZE, (long long) (gen() % 1000)};
+        }
+
+        Tree one_by_one(SIZE), batched(SIZE), parallel(SIZE);
+        double serial = measure([&] {
+            for (const auto &update : updates) one_by_one.leaf_update(update.first, update.second);
+        });
+        double single = measure([&] { batched.apply_batch(updates); });
+        double multi = measure([&] { parallel.apply_batch(updates, threads); });
+
+        std::cout << "n = " << SIZE << ", batch = " << batch
+                  << ", leaf_update x batch: " << serial << " ms"
+                  << ", apply_batch: " << single << " ms"
+                  << ", apply_batch (" << threads << " threads): " << multi << " ms"
+                  << (one_by_one.get_root_value() == parallel.get_root_value() ? "" : " (MISMATCH)") << std::endl;
+    }
+}
@@ -0,0 +1,53 @@
+#include <chrono>
+#include <random>
+#include "../src/monoid_segment_tree.h"
+#include "../src/compact_segment_tree.h"
+
+/*
+ * Compares the memory footprint (and the speed) of the power of two layout and the compact one.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 compact_segment_tree_benchmark.cpp
+ */
+
+struct payload {
+    long long values[4] = {0, 0, 0, 0};
+};
+
+template<typename Tree>
+double measure(Tree &tree, const std::vector<unsigned long> &a, const std::vector<unsigned long> &b, long long &checksum) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < a.size(); ++i) {
+        tree.leaf_update(a[i], (long long) i);
+        checksum += tree.iterative_query(std::min(a[i], b[i]), std::max(a[i], b[i]));
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    std::cout << "memory for a 32 byte payload:" << std::endl;
+    for (unsigned long n : {1UL << 20, (1UL << 20) + 1, 3000000UL, (1UL << 24) + 1}) {
+        algo_lib::tree::monoid_segment_tree<long long> power_of_two(n);
+        algo_lib::tree::compact_segment_tree<long long> compact(n);
+
+        std::cout << "n = " << n
+                  << ", power of two: " << power_of_two.node_count() * sizeof(payload) / (1 << 20) << " MiB"
+                  << ", compact: " << compact.node_count() * sizeof(payload) / (1 << 20) << " MiB" << std::endl;
+    }
+
+    constexpr unsigned long SIZE = (1UL << 20) + 1;
+    std::mt19937_64 gen(42);
+    std::vector<unsigned long> a(2000000), b(2000000);
+    for (unsigned long i = 0; i < a.size(); ++i) {
+        a[i] = gen() % SIZE;
+        b[i] = gen() % SIZE;
+    }
+
+    algo_lib::tree::monoid_segment_tree<long long> power_of_two(SIZE);
+    algo_lib::tree::compact_segment_tree<long long> compact(SIZE);
+    long long checksum_power = 0, checksum_compact = 0;
+
+    std::cout << "n = " << SIZE << ", 2 * 10^6 updates and queries" << std::endl;
+    std::cout << "power of two: " << measure(power_of_two, a, b, checksum_power) << " ms" << std::endl;
+    std::cout << "compact:      " << measure(compact, a, b, checksum_compact) << " ms" << std::endl;
+
+    return checksum_power == checksum_compact ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include <chrono>
+#include <random>
+#include <thread>
+#include "../src/monoid_segment_tree.h"
+#include "../src/concurrent_segment_tree.h"
+
+/*
+ * Query throughput with 1 - 64 reader threads and a single writer thread,
+ * a sequence locked tree against a tree guarded by a single mutex.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 -pthread concurrent_segment_tree_benchmark.cpp
+ */
+
+constexpr unsigned long SIZE = 1UL << 20;
+constexpr auto DURATION = std::chrono::milliseconds(300);
+constexpr auto WRITER_PAUSE = std::chrono::microseconds(10); // the writer applies ~10^5 updates per second
+
+template<typename Query, typename Update>
+double queries_per_second(const unsigned readers, Query query, Update update) {
+    std::atomic<bool> done{false};
+    std::atomic<unsigned long> total{0};
+
+    std::thread writer([&] {
+        std::mt19937_64 gen(7);
+        while (!done) {
+            update(gen() % SIZE, (long long) (gen() % 100));
+            std::this_thread::sleep_for(WRITER_PAUSE);
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (unsigned r = 0; r < readers; ++r) {
+        threads.emplace_back([&, r] {
+            std::mt19937_64 gen(r);
+            unsigned long count = 0;
+            long long checksum = 0;
+
+            while (!done) {
+                const unsigned long a = gen() % SIZE, b = gen() % SIZE;
+                checksum += query(std::min(a, b), std::max(a, b));
+                ++count;
+            }
+
+            total += count + (checksum == 42 ? 1 : 0);
+        });
+    }
+
+    std::this_thread::sleep_for(DURATION);
+    done = true;
+    writer.join();
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    return (double) total / std::chrono::duration<double>(DURATION).count();
+}
+
+int main() {
+    algo_lib::tree::monoid_segment_tree<long long> guarded(SIZE);
+    std::mutex global;
+    algo_lib::tree::concurrent_segment_tree<long long> concurrent(SIZE);
+
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (unsigned readers : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        const double mutex_qps = queries_per_second(readers, [&](unsigned long s, unsigned long e) {
+            std::lock_guard<std::mutex> guard(global);
+            return guarded.iterative_query(s, e);
+        }, [&](unsigned long i, long long v) {
+            std::lock_guard<std::mutex> guard(global);
+            guarded.leaf_update(i, v);
+        });
+
+        const double seqlock_qps = queries_per_second(readers, [&](unsigned long s, unsigned long e) {
+            return concurrent.iterative_query(s, e);
+        }, [&](unsigned long i, long long v) {
+            concurrent.leaf_update(i, v);
+        });
+
+        std::cout << readers << " readers, global mutex: " << (unsigned long) (mutex_qps / 1000)
+                  << "k queries/s, sequence lock: " << (unsigned long) (seqlock_qps / 1000) << "k queries/s" << std::endl;
+    }
+}
@@ -0,0 +1,96 @@
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include "../src/segment_tree.h"
+#include "../src/multi_lane_segment_tree.h"
+
+/*
+ * Compares k_inversions (see usage/segment_tree.cpp) built from k separate segment trees
+ * with the one built on a single multi-lane tree.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O3 -march=native k_inversions_benchmark.cpp
+ */
+
+constexpr unsigned long MOD = 1000000000;
+
+struct modulo_adder {
+    static constexpr bool commutative = true;
+
+    static constexpr unsigned long identity() noexcept {
+        return 0;
+    }
+
+    unsigned long operator()(const unsigned long &lhs, const unsigned long &rhs) const {
+        return (lhs + rhs) % MOD;
+    }
+};
+
+unsigned long separate_trees(const std::vector<unsigned long> &vi, const unsigned long k) {
+    using Tree = algo_lib::tree::segment_tree<unsigned long>;
+    const unsigned long n = vi.size();
+    auto adder = [](const unsigned long &lhs, const unsigned long &rhs) { return (lhs + rhs) % MOD; };
+    auto without_leaf_update = [](const unsigned long &, const unsigned long &updater) { return updater; };
+
+    std::vector<Tree> trees;
+    for (unsigned long i = 0; i < k; ++i) {
+        trees.emplace_back(n, 0, adder);
+    }
+
+    for (unsigned long x = 0; x < n; ++x) {
+        for (long long j = (long long) k - 1; j >= 0; j--) {
+            if (j == 0) {
+                trees[j].update_leaf(vi[x] - 1, 1, without_leaf_update);
+                continue;
+            }
+
+            unsigned long adder_value = vi[x] < n ? trees[j - 1].iterative_query(vi[x], n - 1) : 0;
+            trees[j].update_leaf(vi[x] - 1, adder_value, without_leaf_update);
+        }
+    }
+
+    return trees[k - 1].iterative_query(0, n - 1);
+}
+
+unsigned long single_multi_lane_tree(const std::vector<unsigned long> &vi, const unsigned long k) {
+    const unsigned long n = vi.size();
+    algo_lib::tree::multi_lane_segment_tree<unsigned long, modulo_adder> tree(n, k);
+    std::vector<unsigned long> greater(k), leaf(k);
+
+    for (unsigned long x = 0; x < n; ++x) {
+        std::fill(greater.begin(), greater.end(), 0);
+        if (vi[x] < n) {
+            tree.iterative_query(vi[x], n - 1, greater.data());
+        }
+
+        leaf[0] = 1;
+        for (unsigned long j = 1; j < k; ++j) {
+            leaf[j] = greater[j - 1];
+        }
+        tree.set_leaf(vi[x] - 1, leaf.data());
+    }
+
+    return tree.iterative_query(0, n - 1)[k - 1];
+}
+
+int main() {
+    std::mt19937 gen(42);
+
+    for (unsigned long n : {100000UL, 1000000UL}) {
+        std::vector<unsigned long> vi(n);
+        std::iota(vi.begin(), vi.end(), 1);
+        std::shuffle(vi.begin(), vi.end(), gen);
+
+        for (unsigned long k : {2UL, 10UL, 50UL}) {
+            auto start = std::chrono::steady_clock::now();
+            const unsigned long old_result = separate_trees(vi, k);
+            auto middle = std::chrono::steady_clock::now();
+            const unsigned long new_result = single_multi_lane_tree(vi, k);
+            auto end = std::chrono::steady_clock::now();
+
+            std::cout << "n = " << n << ", k = " << k
+                      << ", separate trees: " << std::chrono::duration<double, std::milli>(middle - start).count()
+                      << " ms, multi-lane: " << std::chrono::duration<double, std::milli>(end - middle).count()
+                      << " ms" << (old_result == new_result ? "" : " (MISMATCH)") << std::endl;
+        }
+    }
+}
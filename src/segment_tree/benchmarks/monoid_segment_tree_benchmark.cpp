@@ -0,0 +1,47 @@
+#include <chrono>
+#include <random>
+#include "../src/segment_tree.h"
+#include "../src/monoid_segment_tree.h"
+
+/*
+ * Compares the std::function driven segment_tree with the monoid_segment_tree.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 monoid_segment_tree_benchmark.cpp
+ */
+
+constexpr unsigned long SIZE = 1UL << 20;
+constexpr unsigned long OPERATIONS = 2000000;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    using value = long long;
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<unsigned long> index(0, SIZE - 1);
+    std::vector<unsigned long> a(OPERATIONS), b(OPERATIONS);
+    for (unsigned long i = 0; i < OPERATIONS; ++i) {
+        a[i] = index(gen);
+        b[i] = index(gen);
+        if (a[i] > b[i]) std::swap(a[i], b[i]);
+    }
+
+    auto plus = [](const value &lhs, const value &rhs) { return lhs + rhs; };
+    algo_lib::tree::segment_tree<value> old_tree(SIZE, 0, plus);
+    algo_lib::tree::monoid_segment_tree<value> new_tree(SIZE);
+    value checksum_old = 0, checksum_new = 0;
+
+    double old_update = measure([&] { for (unsigned long i = 0; i < OPERATIONS; ++i) old_tree.leaf_update(a[i], (value) i); });
+    double new_update = measure([&] { for (unsigned long i = 0; i < OPERATIONS; ++i) new_tree.leaf_update(a[i], (value) i); });
+    double old_query = measure([&] { for (unsigned long i = 0; i < OPERATIONS; ++i) checksum_old += old_tree.iterative_query(a[i], b[i]); });
+    double new_query = measure([&] { for (unsigned long i = 0; i < OPERATIONS; ++i) checksum_new += new_tree.iterative_query(a[i], b[i]); });
+
+    std::cout << "n = " << SIZE << ", operations = " << OPERATIONS << std::endl;
+    std::cout << "segment_tree        update: " << old_update << " ms, query: " << old_query << " ms" << std::endl;
+    std::cout << "monoid_segment_tree update: " << new_update << " ms, query: " << new_query << " ms" << std::endl;
+
+    return checksum_old == checksum_new ? 0 : 1;
+}
@@ -0,0 +1,40 @@
+#include <chrono>
+#include <numeric>
+#include "../src/segment_tree.h"
+
+/*
+ * Compares loading n values with update_leaf against the O(n) build.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 -pthread segment_tree_build_benchmark.cpp
+ */
+
+constexpr unsigned long SIZE = 1UL << 22;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    using value = long long;
+    using Tree = algo_lib::tree::segment_tree<value>;
+    auto plus = [](const value &lhs, const value &rhs) { return lhs + rhs; };
+
+    std::vector<value> values(SIZE);
+    std::iota(values.begin(), values.end(), 0);
+
+    Tree by_leafs(SIZE, 0, plus), built(SIZE, 0, plus);
+    double leafs = measure([&] {
+        for (unsigned long i = 0; i < SIZE; ++i) by_leafs.update_leaf(i, values[i], plus);
+    });
+    double build = measure([&] { built.build(values.begin(), values.end()); });
+    double parallel = measure([&] { built.build(values.begin(), values.end(), std::thread::hardware_concurrency()); });
+
+    std::cout << "n = " << SIZE << std::endl;
+    std::cout << "update_leaf x n:  " << leafs << " ms" << std::endl;
+    std::cout << "build:            " << build << " ms" << std::endl;
+    std::cout << "build (" << std::thread::hardware_concurrency() << " threads): " << parallel << " ms" << std::endl;
+
+    return by_leafs.get_root_value() == built.get_root_value() ? 0 : 1;
+}
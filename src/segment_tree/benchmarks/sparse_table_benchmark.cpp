@@ -0,0 +1,50 @@
+#include <chrono>
+#include <random>
+#include "../src/monoid_segment_tree.h"
+#include "../src/sparse_table.h"
+
+/*
+ * Finds the crossover point between the sparse table (O(n * log(n)) build, O(1) query)
+ * and the segment tree (O(n) build, O(log(n)) query) for the range minimum queries.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 sparse_table_benchmark.cpp
+ */
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    using namespace algo_lib::tree;
+    std::mt19937_64 gen(42);
+
+    for (unsigned long n : {100000UL, 1000000UL}) {
+        std::vector<int> values(n);
+        for (auto &v : values) v = (int) (gen() % 1000000);
+
+        for (unsigned long queries : {1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL}) {
+            std::vector<unsigned long> a(queries), b(queries);
+            for (unsigned long i = 0; i < queries; ++i) {
+                a[i] = gen() % n;
+                b[i] = gen() % n;
+                if (a[i] > b[i]) std::swap(a[i], b[i]);
+            }
+
+            long long checksum_tree = 0, checksum_table = 0;
+            double tree_time = measure([&] {
+                monoid_segment_tree<int, monoids::min<int>> tree(values.begin(), values.end());
+                for (unsigned long i = 0; i < queries; ++i) checksum_tree += tree.iterative_query(a[i], b[i]);
+            });
+            double table_time = measure([&] {
+                sparse_table<int, monoids::min<int>> table(values.begin(), values.end());
+                for (unsigned long i = 0; i < queries; ++i) checksum_table += table.iterative_query(a[i], b[i]);
+            });
+
+            std::cout << "n = " << n << ", queries = " << queries
+                      << ", segment tree: " << tree_time << " ms, sparse table: " << table_time << " ms"
+                      << (checksum_tree == checksum_table ? "" : " (MISMATCH)") << std::endl;
+        }
+    }
+}
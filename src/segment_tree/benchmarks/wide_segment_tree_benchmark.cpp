@@ -0,0 +1,58 @@
+#include <chrono>
+#include <random>
+#include "../src/monoid_segment_tree.h"
+#include "../src/wide_segment_tree.h"
+
+/*
+ * Compares the binary heap layout with the cache line wide one on a large array.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O3 -march=native wide_segment_tree_benchmark.cpp
+ */
+
+constexpr unsigned long SIZE = 10000000;
+constexpr unsigned long OPERATIONS = 2000000;
+
+template<typename Tree>
+void run(const char *name, const std::vector<int> &values,
+         const std::vector<unsigned long> &a, const std::vector<unsigned long> &b) {
+    Tree tree(values.begin(), values.end());
+    double update = 1e9, query = 1e9;
+    long long checksum = 0;
+
+    // the best of a few repetitions, the timings on a shared machine are noisy
+    for (int repetition = 0; repetition < 5; ++repetition) {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long i = 0; i < OPERATIONS; ++i) {
+            tree.set_leaf(a[i], (int) i);
+        }
+        auto middle = std::chrono::steady_clock::now();
+        for (unsigned long i = 0; i < OPERATIONS; ++i) {
+            checksum += tree.iterative_query(std::min(a[i], b[i]), std::max(a[i], b[i]));
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        update = std::min(update, std::chrono::duration<double, std::milli>(middle - start).count());
+        query = std::min(query, std::chrono::duration<double, std::milli>(end - middle).count());
+    }
+
+    std::cout << name << " update: " << update << " ms, query: " << query
+              << " ms (checksum " << checksum << ")" << std::endl;
+}
+
+int main() {
+    using namespace algo_lib::tree;
+    std::mt19937_64 gen(42);
+    std::vector<int> values(SIZE);
+    for (auto &v : values) v = (int) (gen() % 1000);
+
+    std::vector<unsigned long> a(OPERATIONS), b(OPERATIONS);
+    for (unsigned long i = 0; i < OPERATIONS; ++i) {
+        a[i] = gen() % SIZE;
+        b[i] = gen() % SIZE;
+    }
+
+    std::cout << "n = " << SIZE << ", operations = " << OPERATIONS << std::endl;
+    run<monoid_segment_tree<int, monoids::plus<int>>>("binary sum:", values, a, b);
+    run<wide_segment_tree<int, monoids::plus<int>>>("wide   sum:", values, a, b);
+    run<monoid_segment_tree<int, monoids::min<int>>>("binary min:", values, a, b);
+    run<wide_segment_tree<int, monoids::min<int>>>("wide   min:", values, a, b);
+}
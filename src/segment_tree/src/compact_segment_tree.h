@@ -0,0 +1,174 @@
+#ifndef SRC_COMPACT_SEGMENT_TREE_H
+#define SRC_COMPACT_SEGMENT_TREE_H
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * A segment tree which takes exactly 2 * n nodes for n leafs.
+         * @tparam data_type a type of elements stored in a tree (copy assignable and copy constructible)
+         * @tparam monoid a combiner policy, see monoids.h
+         *
+         * The leafs are stored at (n, ... , 2 * n - 1) positions and the parent of a node i is i / 2,
+         * the same as in the tree::monoid_segment_tree, but n is not rounded up to the power of two.
+         * Thus some of the nodes cover leafs from the both ends of an array and the node at index 1
+         * is not the aggregate of the whole array when n is not the power of two.
+         * The bottom-up query does not touch these nodes, so it is correct for non-commutative monoids too.
+         */
+        template<typename data_type, typename monoid = monoids::plus<data_type>>
+        class compact_segment_tree {
+            static_assert(std::is_copy_assignable<data_type>::value && std::is_copy_constructible<data_type>::value);
+
+        public:
+            explicit compact_segment_tree(const ul desirable_size, const monoid combiner = monoid())
+                    : size(desirable_size), combine(combiner) {
+                if (desirable_size < 1) {
+                    throw std::out_of_range("Size of a tree should exceed 1.");
+                }
+
+                tree.resize(size << (ul) 1, monoid::identity());
+            }
+
+            /**
+             * Constructs a tree with exactly std::distance(first, last) leafs, see build.
+             */
+            template<typename ForwardIterator>
+            compact_segment_tree(ForwardIterator first, ForwardIterator last, const monoid combiner = monoid())
+                    : compact_segment_tree((ul) std::distance(first, last), combiner) {
+                build(first, last);
+            }
+
+            /**
+             * Replaces the leafs with the values from [first, last) (the remaining leafs are set
+             * to the identity) and calculates the internal nodes in O(n) time.
+             */
+            template<typename ForwardIterator>
+            void build(ForwardIterator first, ForwardIterator last) {
+                if ((ul) std::distance(first, last) > size) {
+                    throw std::out_of_range("Provided range exceeds the size of a tree.");
+                }
+
+                auto leaf = std::copy(first, last, tree.begin() + size);
+                std::fill(leaf, tree.end(), monoid::identity());
+
+                for (ul node = size - 1; node > 0; --node) {
+                    pull(node);
+                }
+            }
+
+            /**
+             * Updates the leaf, and traverses the tree to the top.
+             * @param leaf_index an index of a node to be updated
+             * @param updater a new value to combine with the previous one
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with @updater
+             */
+            template<typename update_fn>
+            void update_leaf(ul leaf_index, const data_type updater, update_fn result_function) {
+                is_in_leaf_bounds(leaf_index);
+
+                leaf_index += size;
+                tree[leaf_index] = result_function(tree[leaf_index], updater);
+
+                for (leaf_index >>= 1; leaf_index > 0; leaf_index >>= 1) {
+                    pull(leaf_index);
+                }
+            }
+
+            /**
+             * Combines the leaf with @updater using the monoid.
+             */
+            void leaf_update(const ul leaf_index, const data_type updater) {
+                update_leaf(leaf_index, updater, combine);
+            }
+
+            /**
+             * Overwrites the leaf with @value.
+             */
+            void set_leaf(const ul leaf_index, const data_type value) {
+                update_leaf(leaf_index, value, [](const data_type &, const data_type &v) { return v; });
+            }
+
+            /**
+             * Combines all of the leafs in [s_index, e_index] (inclusive) in O(log(n)) time.
+             */
+            data_type iterative_query(ul s_index, ul e_index) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+
+                data_type left_result = monoid::identity();
+                data_type right_result = monoid::identity();
+
+                s_index += size;
+                e_index += size + 1;
+
+                while (s_index < e_index) {
+                    if (s_index & (ul) 1) {
+                        left_result = combine(left_result, tree[s_index++]);
+                    }
+
+                    if (e_index & (ul) 1) {
+                        right_result = combine(tree[--e_index], right_result);
+                    }
+
+                    s_index >>= 1;
+                    e_index >>= 1;
+                }
+
+                return combine(left_result, right_result);
+            }
+
+            data_type get_leaf_value(const ul index) const {
+                is_in_leaf_bounds(index);
+
+                return tree[index + size];
+            }
+
+            /**
+             * @return an aggregate of the whole array, in this layout it is calculated
+             * by a query, since the node at index 1 may not cover the leafs in order.
+             */
+            data_type get_root_value() const {
+                return iterative_query(0, size - 1);
+            }
+
+            ul leaf_count() const noexcept {
+                return size;
+            }
+
+            /**
+             * @return the number of nodes allocated, always 2 * leaf_count()
+             */
+            ul node_count() const noexcept {
+                return tree.size();
+            }
+
+        private:
+            void pull(const ul node) {
+                tree[node] = combine(tree[2 * node], tree[2 * node + 1]);
+            }
+
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            ul size;
+            std::vector<data_type> tree; // the node at index 0 is unused
+            monoid combine;
+        };
+    }
+}
+
+#endif //SRC_COMPACT_SEGMENT_TREE_H
@@ -0,0 +1,213 @@
+#ifndef SRC_CONCURRENT_SEGMENT_TREE_H
+#define SRC_CONCURRENT_SEGMENT_TREE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * A segment tree which can be queried by many threads while other threads update it.
+         * @tparam data_type a type of elements stored in a tree, it has to be trivially copyable
+         * (preferably lock free as a std::atomic, f.e. any integer or floating point type)
+         * @tparam monoid a combiner policy, see monoids.h
+         *
+         * The tree is guarded by a sequence lock. Writers are serialised by a mutex and make
+         * the sequence number odd for the time of an update. Readers take no locks and write nothing
+         * to the shared memory: a query reads the sequence number, reads the nodes and checks
+         * that the sequence number has not changed in the meantime, otherwise it starts again.
+         * Thus the queries scale with the number of reader threads and every query is linearizable
+         * (it returns the state between two updates), but a reader may retry while updates go on,
+         * so the batched updates (apply_batch) are cheaper for the readers than single ones.
+         */
+        template<typename data_type, typename monoid = monoids::plus<data_type>>
+        class concurrent_segment_tree {
+            static_assert(std::is_trivially_copyable<data_type>::value,
+                          "Values of a concurrent tree are read optimistically, so they have to be trivially copyable.");
+
+        public:
+            explicit concurrent_segment_tree(const ul desirable_size, const monoid combiner = monoid())
+                    : combine(combiner) {
+                if (desirable_size < 1) {
+                    throw std::out_of_range("Size of a tree should exceed 1.");
+                }
+
+                while (size < desirable_size) {
+                    size <<= 1;
+                }
+
+                tree.reset(new std::atomic<data_type>[size << (ul) 1]);
+                for (ul node = 0; node < (size << (ul) 1); ++node) {
+                    tree[node].store(monoid::identity(), std::memory_order_relaxed);
+                }
+            }
+
+            /**
+             * Updates the leaf and traverses the tree to the top, blocks the other writers only.
+             * @param leaf_index an index of a node to be updated
+             * @param updater a new value to combine with the previous one
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with @updater
+             */
+            template<typename update_fn>
+            void update_leaf(const ul leaf_index, const data_type updater, update_fn result_function) {
+                is_in_leaf_bounds(leaf_index);
+
+                std::lock_guard<std::mutex> guard(writer);
+                write_section([&] { write_leaf(leaf_index, updater, result_function); });
+            }
+
+            void leaf_update(const ul leaf_index, const data_type updater) {
+                update_leaf(leaf_index, updater, combine);
+            }
+
+            void set_leaf(const ul leaf_index, const data_type value) {
+                update_leaf(leaf_index, value, [](const data_type &, const data_type &v) { return v; });
+            }
+
+            /**
+             * Applies all of the updates as a single write, so the readers see either none or all of them.
+             * @param updates pairs of (leaf_index, updater) combined with the monoid
+             */
+            void apply_batch(const std::vector<std::pair<ul, data_type>> &updates) {
+                for (const auto &update : updates) {
+                    is_in_leaf_bounds(update.first);
+                }
+
+                std::lock_guard<std::mutex> guard(writer);
+                write_section([&] {
+                    for (const auto &update : updates) {
+                        write_leaf(update.first, update.second, combine);
+                    }
+                });
+            }
+
+            /**
+             * Combines all of the leafs in [s_index, e_index] (inclusive), never blocks.
+             */
+            data_type iterative_query(const ul s_index, const ul e_index) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+
+                return read_section([&] { return query(s_index, e_index); });
+            }
+
+            data_type get_leaf_value(const ul index) const {
+                is_in_leaf_bounds(index);
+
+                return tree[index + size].load(std::memory_order_acquire);
+            }
+
+            data_type get_root_value() const {
+                return tree[1].load(std::memory_order_acquire);
+            }
+
+            ul leaf_count() const noexcept {
+                return size;
+            }
+
+        private:
+            /**
+             * Runs @write with the sequence number made odd, the caller holds the writer mutex.
+             */
+            template<typename Fn>
+            void write_section(Fn write) {
+                const unsigned long current = sequence.load(std::memory_order_relaxed);
+                sequence.store(current + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                write();
+
+                sequence.store(current + 2, std::memory_order_release);
+            }
+
+            /**
+             * Runs @read until it is not interleaved with any write section.
+             */
+            template<typename Fn>
+            data_type read_section(Fn read) const {
+                while (true) {
+                    const unsigned long before = sequence.load(std::memory_order_acquire);
+                    if (before & (ul) 1) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    const data_type result = read();
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence.load(std::memory_order_relaxed) == before) {
+                        return result;
+                    }
+                }
+            }
+
+            template<typename update_fn>
+            void write_leaf(ul leaf_index, const data_type &updater, update_fn &result_function) {
+                leaf_index += size;
+                store(leaf_index, result_function(load(leaf_index), updater));
+
+                for (leaf_index >>= 1; leaf_index > 0; leaf_index >>= 1) {
+                    store(leaf_index, combine(load(2 * leaf_index), load(2 * leaf_index + 1)));
+                }
+            }
+
+            data_type query(ul s_index, ul e_index) const {
+                data_type left_result = monoid::identity();
+                data_type right_result = monoid::identity();
+
+                s_index += size;
+                e_index += size + 1;
+
+                while (s_index < e_index) {
+                    if (s_index & (ul) 1) {
+                        left_result = combine(left_result, load(s_index++));
+                    }
+
+                    if (e_index & (ul) 1) {
+                        right_result = combine(load(--e_index), right_result);
+                    }
+
+                    s_index >>= 1;
+                    e_index >>= 1;
+                }
+
+                return combine(left_result, right_result);
+            }
+
+            data_type load(const ul node) const {
+                return tree[node].load(std::memory_order_relaxed);
+            }
+
+            void store(const ul node, const data_type &value) {
+                tree[node].store(value, std::memory_order_relaxed);
+            }
+
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            // the sequence number is kept on its own cache line, readers only read it
+            alignas(64) std::atomic<unsigned long> sequence{0};
+            alignas(64) std::mutex writer;
+            ul size = 1;
+            std::unique_ptr<std::atomic<data_type>[]> tree; // a root is stored at index 1
+            monoid combine;
+        };
+    }
+}
+
+#endif //SRC_CONCURRENT_SEGMENT_TREE_H
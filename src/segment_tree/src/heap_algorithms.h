@@ -0,0 +1,203 @@
+#ifndef SRC_HEAP_ALGORITHMS_H
+#define SRC_HEAP_ALGORITHMS_H
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <stdexcept>
+#include "parallel_levels.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * Algorithms shared by the segment trees stored in a heap layout: a root at index 1,
+         * the children of a node at 2 * node and 2 * node + 1, and @size leafs (a power of two)
+         * at (size, ... , 2 * size - 1) positions of @tree.
+         *
+         * They are parameterised on @combine, so both the std::function of tree::segment_tree
+         * and the monoid of tree::monoid_segment_tree can be used, the latter stays inlined.
+         */
+        namespace detail {
+            /**
+             * Calculates the internal nodes of a subtree rooted at @root, level by level from the bottom.
+             */
+            template<typename data_type, typename combine_fn>
+            void build_subtree(std::vector<data_type> &tree, const ul size, const ul root, const combine_fn &combine) {
+                ul depth = 0;
+                while ((root << depth) < size) {
+                    ++depth;
+                }
+
+                while (depth-- > 0) {
+                    for (ul node = root << depth; node < (root + 1) << depth; ++node) {
+                        tree[node] = combine(tree[2 * node], tree[2 * node + 1]);
+                    }
+                }
+            }
+
+            /**
+             * Replaces the leafs with the values from [first, last) (the remaining leafs are set
+             * to @padding) and calculates the internal levels bottom-up in O(n) time.
+             * @param threads the number of threads to build the tree with, every thread builds
+             * a separate subtree and the levels above these subtrees are built by the calling thread.
+             */
+            template<typename data_type, typename combine_fn, typename ForwardIterator>
+            void build(std::vector<data_type> &tree, const ul size,
+                       ForwardIterator first, ForwardIterator last,
+                       const data_type &padding, const combine_fn &combine, const unsigned threads) {
+                if ((ul) std::distance(first, last) > size) {
+                    throw std::out_of_range("Provided range exceeds the size of a tree.");
+                }
+
+                auto leaf = std::copy(first, last, tree.begin() + size);
+                std::fill(leaf, tree.end(), padding);
+
+                ul subtrees = 1; // subtrees are rooted at (subtrees, ... , 2 * subtrees - 1) positions
+                while (subtrees * 2 <= threads && subtrees * 2 <= size) {
+                    subtrees <<= 1;
+                }
+
+                if (subtrees == 1) {
+                    build_subtree(tree, size, 1, combine);
+                } else {
+                    std::vector<std::thread> workers;
+                    for (ul root = subtrees; root < 2 * subtrees; ++root) {
+                        workers.emplace_back([&tree, &combine, size, root] { build_subtree(tree, size, root, combine); });
+                    }
+
+                    for (auto &worker : workers) {
+                        worker.join();
+                    }
+                }
+
+                for (ul node = subtrees - 1; node > 0; --node) {
+                    tree[node] = combine(tree[2 * node], tree[2 * node + 1]);
+                }
+            }
+
+            /**
+             * Writes all of the leafs first (in the order of @updates, so the repeated indexes
+             * are combined one after another), then recalculates the ancestors of the updated leafs,
+             * level by level, every one of them exactly once, see dirty_levels and for_each_level.
+             * Nothing is written if any of the indexes is out of range.
+             */
+            template<typename data_type, typename update_fn, typename combine_fn>
+            void apply_batch(std::vector<data_type> &tree, const ul size,
+                             const std::vector<std::pair<ul, data_type>> &updates,
+                             update_fn result_function, const combine_fn &combine, const unsigned threads) {
+                for (const auto &update : updates) {
+                    if (update.first >= size) {
+                        throw std::out_of_range("Provided index is out of range.");
+                    }
+                }
+
+                std::vector<ul> leafs;
+                leafs.reserve(updates.size());
+                for (const auto &update : updates) {
+                    const ul leaf_index = update.first + size;
+                    tree[leaf_index] = result_function(tree[leaf_index], update.second);
+                    leafs.push_back(leaf_index);
+                }
+
+                for_each_level(dirty_levels(leafs, size), threads, [&tree, &combine](const ul node) {
+                    tree[node] = combine(tree[2 * node], tree[2 * node + 1]);
+                });
+            }
+
+            /**
+             * Descends the tree once to find the largest e_index such that @pred holds
+             * for [s_index, e_index), see max_right of the trees.
+             * @param length the number of elements, the leafs past it hold the @identity
+             * @param identity the neutral element of @combine, pred(identity) must be true
+             */
+            template<typename data_type, typename combine_fn, typename predicate>
+            ul max_right(const std::vector<data_type> &tree, const ul size, const ul length, ul s_index,
+                         const data_type &identity, const combine_fn &combine, predicate pred) {
+                if (s_index > length) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+
+                if (s_index == length) {
+                    return length;
+                }
+
+                s_index += size;
+                data_type accumulated = identity;
+
+                do {
+                    // climbs while the node is a left child, so the node covers the longest interval from s_index
+                    while (!(s_index & (ul) 1)) {
+                        s_index >>= 1;
+                    }
+
+                    if (!pred(combine(accumulated, tree[s_index]))) {
+                        // the answer is inside this node, descends to the first leaf that breaks the predicate
+                        while (s_index < size) {
+                            s_index <<= 1;
+                            if (pred(combine(accumulated, tree[s_index]))) {
+                                accumulated = combine(accumulated, tree[s_index]);
+                                ++s_index;
+                            }
+                        }
+
+                        // the padding leafs hold the identity, so the predicate can break there only
+                        return std::min(s_index - size, length);
+                    }
+
+                    accumulated = combine(accumulated, tree[s_index]);
+                    ++s_index;
+                } while ((s_index & (~s_index + 1)) != s_index); // stops after the last node on the level
+
+                return length;
+            }
+
+            /**
+             * The mirror image of max_right, finds the smallest s_index such that @pred holds
+             * for [s_index, e_index).
+             */
+            template<typename data_type, typename combine_fn, typename predicate>
+            ul min_left(const std::vector<data_type> &tree, const ul size, const ul length, ul e_index,
+                        const data_type &identity, const combine_fn &combine, predicate pred) {
+                if (e_index > length) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+
+                if (e_index == 0) {
+                    return 0;
+                }
+
+                e_index += size;
+                data_type accumulated = identity;
+
+                do {
+                    --e_index;
+                    while (e_index > 1 && (e_index & (ul) 1)) {
+                        e_index >>= 1;
+                    }
+
+                    if (!pred(combine(tree[e_index], accumulated))) {
+                        while (e_index < size) {
+                            e_index = 2 * e_index + 1;
+                            if (pred(combine(tree[e_index], accumulated))) {
+                                accumulated = combine(tree[e_index], accumulated);
+                                --e_index;
+                            }
+                        }
+
+                        return e_index + 1 - size;
+                    }
+
+                    accumulated = combine(tree[e_index], accumulated);
+                } while ((e_index & (~e_index + 1)) != e_index);
+
+                return 0;
+            }
+        }
+    }
+}
+
+#endif //SRC_HEAP_ALGORITHMS_H
@@ -0,0 +1,297 @@
+#ifndef SRC_LAZY_SEGMENT_TREE_H
+#define SRC_LAZY_SEGMENT_TREE_H
+
+#include <vector>
+#include <optional>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * Tag policies for the lazy_segment_tree.
+         *
+         * Every tag policy provides:
+         *  - tag_type - a type of a pending operation stored in the internal nodes,
+         *  - static identity() - a tag which does nothing,
+         *  - compose(newer, older) - a single tag equal to applying @older first and @newer afterwards,
+         *  - apply(value, tag, length) - a value of a node covering @length leafs after applying the tag.
+         *
+         * The policies are parametrised with the monoid, because the effect of a tag on an aggregate
+         * depends on it (adding x to a range adds length * x to its sum, but only x to its minimum).
+         * For min and max the leafs should hold actual values (not the identity) before adding to them.
+         */
+        namespace tags {
+            namespace detail {
+                template<typename data_type, typename monoid>
+                constexpr bool is_sum = std::is_same<monoid, monoids::plus<data_type>>::value;
+            }
+
+            /**
+             * Adds a value to every element of a range.
+             */
+            template<typename data_type, typename monoid = monoids::plus<data_type>>
+            struct add {
+                using tag_type = data_type;
+
+                static tag_type identity() {
+                    return tag_type(0);
+                }
+
+                tag_type compose(const tag_type &newer, const tag_type &older) const {
+                    return newer + older;
+                }
+
+                data_type apply(const data_type &value, const tag_type &tag, const ul length) const {
+                    if constexpr (detail::is_sum<data_type, monoid>) {
+                        return value + tag * static_cast<data_type>(length);
+                    } else {
+                        return value + tag;
+                    }
+                }
+            };
+
+            /**
+             * Assigns a value to every element of a range.
+             */
+            template<typename data_type, typename monoid = monoids::plus<data_type>>
+            struct assign {
+                using tag_type = std::optional<data_type>;
+
+                static tag_type identity() {
+                    return std::nullopt;
+                }
+
+                tag_type compose(const tag_type &newer, const tag_type &older) const {
+                    return newer ? newer : older;
+                }
+
+                data_type apply(const data_type &value, const tag_type &tag, const ul length) const {
+                    if (!tag) {
+                        return value;
+                    }
+
+                    if constexpr (detail::is_sum<data_type, monoid>) {
+                        return *tag * static_cast<data_type>(length);
+                    } else {
+                        return *tag;
+                    }
+                }
+            };
+
+            /**
+             * Replaces every element x of a range with a * x + b, the tag is stored as a pair (a, b).
+             * Only the sum is supported, since a negative @a would turn a minimum into a maximum.
+             */
+            template<typename data_type, typename monoid = monoids::plus<data_type>>
+            struct affine {
+                static_assert(detail::is_sum<data_type, monoid>, "Affine tags are supported for sums only.");
+                using tag_type = std::pair<data_type, data_type>;
+
+                static tag_type identity() {
+                    return {data_type(1), data_type(0)};
+                }
+
+                tag_type compose(const tag_type &newer, const tag_type &older) const {
+                    return {newer.first * older.first, newer.first * older.second + newer.second};
+                }
+
+                data_type apply(const data_type &value, const tag_type &tag, const ul length) const {
+                    return tag.first * value + tag.second * static_cast<data_type>(length);
+                }
+            };
+        }
+
+        /**
+         * A segment tree with lazy propagation, both range updates and range queries take O(log(n)).
+         * @tparam data_type a type of elements stored in a tree
+         * @tparam monoid a combiner policy, see monoids.h
+         * @tparam tag a tag policy, see the tags namespace above
+         *
+         * The layout is the same as in the tree::segment_tree (a root at index 1, leafs at
+         * positions (size, ... , 2 * size - 1)), pending tags are stored for the internal nodes only.
+         * Pending tags are pushed down from the top before every bottom-up pass,
+         * so queries are not const.
+         */
+        template<typename data_type,
+                typename monoid = monoids::plus<data_type>,
+                typename tag = tags::add<data_type, monoid>>
+        class lazy_segment_tree {
+            using tag_type = typename tag::tag_type;
+
+        public:
+            explicit lazy_segment_tree(const ul desirable_size,
+                                       const monoid combiner = monoid(),
+                                       const tag tag_policy = tag())
+                    : combine(combiner), tagger(tag_policy) {
+                if (desirable_size < 1) {
+                    throw std::out_of_range("Size of a tree should exceed 1.");
+                }
+
+                while (size < desirable_size) {
+                    size <<= 1;
+                    ++log;
+                }
+
+                tree.resize(size << (ul) 1, monoid::identity());
+                lazy.resize(size, tag::identity());
+            }
+
+            /**
+             * Applies @t to every leaf in [s_index, e_index] (inclusive).
+             */
+            void update_range(ul s_index, ul e_index, const tag_type &t) {
+                check_interval(s_index, e_index);
+
+                s_index += size;
+                e_index += size + 1;
+                push_borders(s_index, e_index);
+
+                ul l = s_index, r = e_index, length = 1;
+                while (l < r) {
+                    if (l & (ul) 1) {
+                        apply_to_node(l++, t, length);
+                    }
+
+                    if (r & (ul) 1) {
+                        apply_to_node(--r, t, length);
+                    }
+
+                    l >>= 1;
+                    r >>= 1;
+                    length <<= 1;
+                }
+
+                for (ul i = 1; i <= log; ++i) {
+                    if (((s_index >> i) << i) != s_index) {
+                        pull(s_index >> i);
+                    }
+
+                    if (((e_index >> i) << i) != e_index) {
+                        pull((e_index - 1) >> i);
+                    }
+                }
+            }
+
+            /**
+             * Overwrites the leaf with @value.
+             */
+            void set_leaf(ul leaf_index, const data_type value) {
+                is_in_leaf_bounds(leaf_index);
+
+                leaf_index += size;
+                for (ul i = log; i >= 1; --i) {
+                    push(leaf_index >> i, (ul) 1 << i);
+                }
+
+                tree[leaf_index] = value;
+                for (ul i = 1; i <= log; ++i) {
+                    pull(leaf_index >> i);
+                }
+            }
+
+            /**
+             * Combines all of the leafs in [s_index, e_index] (inclusive).
+             */
+            data_type iterative_query(ul s_index, ul e_index) {
+                check_interval(s_index, e_index);
+
+                s_index += size;
+                e_index += size + 1;
+                push_borders(s_index, e_index);
+
+                data_type left_result = monoid::identity();
+                data_type right_result = monoid::identity();
+
+                while (s_index < e_index) {
+                    if (s_index & (ul) 1) {
+                        left_result = combine(left_result, tree[s_index++]);
+                    }
+
+                    if (e_index & (ul) 1) {
+                        right_result = combine(tree[--e_index], right_result);
+                    }
+
+                    s_index >>= 1;
+                    e_index >>= 1;
+                }
+
+                return combine(left_result, right_result);
+            }
+
+            data_type get_leaf_value(const ul index) {
+                return iterative_query(index, index);
+            }
+
+            data_type get_root_value() const {
+                return tree[1];
+            }
+
+        private:
+            /**
+             * Applies the tag to a node which covers @length leafs.
+             */
+            void apply_to_node(const ul node, const tag_type &t, const ul length) {
+                tree[node] = tagger.apply(tree[node], t, length);
+                if (node < size) {
+                    lazy[node] = tagger.compose(t, lazy[node]);
+                }
+            }
+
+            /**
+             * Pushes the pending tag of a node (which covers @length leafs) to its children.
+             */
+            void push(const ul node, const ul length) {
+                apply_to_node(2 * node, lazy[node], length >> 1);
+                apply_to_node(2 * node + 1, lazy[node], length >> 1);
+                lazy[node] = tag::identity();
+            }
+
+            void pull(const ul node) {
+                tree[node] = combine(tree[2 * node], tree[2 * node + 1]);
+            }
+
+            /**
+             * Pushes the tags on the paths from the root to both borders of a half open interval
+             * [s_index, e_index) given as the leaf positions in a tree.
+             */
+            void push_borders(const ul s_index, const ul e_index) {
+                for (ul i = log; i >= 1; --i) {
+                    if (((s_index >> i) << i) != s_index) {
+                        push(s_index >> i, (ul) 1 << i);
+                    }
+
+                    if (((e_index >> i) << i) != e_index) {
+                        push((e_index - 1) >> i, (ul) 1 << i);
+                    }
+                }
+            }
+
+            void check_interval(const ul s_index, const ul e_index) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+            }
+
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            ul size = 1;
+            ul log = 0; // size == 2^log
+            std::vector<data_type> tree;
+            std::vector<tag_type> lazy;
+            monoid combine;
+            tag tagger;
+        };
+    }
+}
+
+#endif //SRC_LAZY_SEGMENT_TREE_H
@@ -0,0 +1,277 @@
+#ifndef SRC_MONOID_SEGMENT_TREE_H
+#define SRC_MONOID_SEGMENT_TREE_H
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include "monoids.h"
+#include "heap_algorithms.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * A segment tree with the combiner fixed at compile time.
+         * @tparam data_type a type of elements stored in a tree (copy assignable and copy constructible)
+         * @tparam monoid a combiner policy, see monoids.h for the expected interface
+         *
+         * It mirrors the tree::segment_tree (the same heap layout, the same method names),
+         * but there is no std::function nor virtual interface in between,
+         * so the combine is inlined into the loops of update_leaf and iterative_query.
+         *
+         * The query keeps the left and the right partial results separately,
+         * thus the monoid does not have to be commutative.
+         */
+        template<typename data_type, typename monoid = monoids::plus<data_type>>
+        class monoid_segment_tree {
+            static_assert(std::is_copy_assignable<data_type>::value && std::is_copy_constructible<data_type>::value);
+
+        public:
+            /**
+             * This ctor takes up approximately O(@desirable_size) time to construct the object.
+             * @param combiner an instance of the monoid, useful when the combine carries a state (f.e. a modulo)
+             */
+            explicit monoid_segment_tree(const ul desirable_size, const monoid combiner = monoid())
+                    : length(desirable_size), combine(combiner) {
+                if (desirable_size < 1) {
+                    throw std::out_of_range("Size of a tree should exceed 1.");
+                }
+
+                while (size < desirable_size) {
+                    size <<= 1;
+                }
+
+                tree.resize(size << (ul) 1, monoid::identity());
+            }
+
+            /**
+             * Constructs a tree with leafs initialised from [first, last), see build.
+             */
+            template<typename ForwardIterator>
+            monoid_segment_tree(ForwardIterator first,
+                                ForwardIterator last,
+                                const monoid combiner = monoid(),
+                                const unsigned threads = 1)
+                    : monoid_segment_tree((ul) std::distance(first, last), combiner) {
+                build(first, last, threads);
+            }
+
+            /**
+             * Replaces the leafs with the values from [first, last) (the remaining leafs are set
+             * to the identity) and calculates the internal levels bottom-up in O(n) time.
+             * @param threads the number of threads to build the tree with, every thread builds
+             * a separate subtree and the levels above these subtrees are built by the calling thread.
+             */
+            template<typename ForwardIterator>
+            void build(ForwardIterator first, ForwardIterator last, const unsigned threads = 1) {
+                detail::build(tree, size, first, last, monoid::identity(), combine, threads);
+            }
+
+            /**
+             * Updates the leaf, and traverses the tree to the top.
+             * @param leaf_index an index of a node to be updated
+             * @param updater a new value to combine with the previous one
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with @updater
+             */
+            template<typename update_fn>
+            void update_leaf(ul leaf_index, const data_type updater, update_fn result_function) {
+                is_in_leaf_bounds(leaf_index);
+
+                leaf_index += size;
+                tree[leaf_index] = result_function(tree[leaf_index], updater);
+                leaf_index >>= 1;
+
+                while (leaf_index) {
+                    pull(leaf_index);
+                    leaf_index >>= 1;
+                }
+            }
+
+            /**
+             * Combines the leaf with @updater using the monoid.
+             */
+            void leaf_update(const ul leaf_index, const data_type updater) {
+                update_leaf(leaf_index, updater, combine);
+            }
+
+            /**
+             * Applies a batch of leaf updates at once. All of the leafs are written first (in the order
+             * of @updates, so the repeated indexes are combined one after another), then only
+             * the ancestors of the updated leafs are recalculated, level by level, every one of them
+             * exactly once per batch.
+             * @param updates pairs of (leaf_index, updater)
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with an updater
+             * @param threads the number of threads every level is split between
+             */
+            template<typename update_fn,
+                    typename = std::enable_if_t<std::is_invocable<update_fn, data_type, data_type>::value>>
+            void apply_batch(const std::vector<std::pair<ul, data_type>> &updates,
+                             update_fn result_function,
+                             const unsigned threads = 1) {
+                detail::apply_batch(tree, size, updates, result_function, combine, threads);
+            }
+
+            /**
+             * Applies a batch of updates combining them with the monoid.
+             */
+            void apply_batch(const std::vector<std::pair<ul, data_type>> &updates, const unsigned threads = 1) {
+                apply_batch(updates, combine, threads);
+            }
+
+            /**
+             * Overwrites the leaf with @value.
+             */
+            void set_leaf(const ul leaf_index, const data_type value) {
+                update_leaf(leaf_index, value, [](const data_type &, const data_type &v) { return v; });
+            }
+
+            /**
+             * Iterates over a tree in a non-recursive manner, combining all of
+             * the O(log(n)) intervals that [s_index, e_index] is being divided into.
+             * @param s_index a start index for the resulting interval
+             * @param e_index an end index for the resulting interval (inclusive)
+             */
+            data_type iterative_query(ul s_index, ul e_index) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+
+                data_type left_result = monoid::identity();
+                data_type right_result = monoid::identity();
+
+                // a half open interval [s_index, e_index) on the leaf level
+                s_index += size;
+                e_index += size + 1;
+
+                while (s_index < e_index) {
+                    if (s_index & (ul) 1) {
+                        left_result = combine(left_result, tree[s_index++]);
+                    }
+
+                    if (e_index & (ul) 1) {
+                        right_result = combine(tree[--e_index], right_result);
+                    }
+
+                    s_index >>= 1;
+                    e_index >>= 1;
+                }
+
+                return combine(left_result, right_result);
+            }
+
+            /**
+             * Descends the tree once to find the furthest end of an interval starting at @s_index
+             * for which @pred holds, f.e. the first index where the prefix sum exceeds some K.
+             * @param s_index a start index of the interval
+             * @param pred a predicate over the accumulated values, pred(monoid::identity()) must be true
+             * and pred should be monotone (once false it stays false for longer intervals)
+             * @return the largest e_index such that pred holds for the half open interval [s_index, e_index),
+             * so it is the first index that makes pred false, or the number of elements if there is none.
+             * Takes O(log(n)) time.
+             */
+            template<typename predicate>
+            ul max_right(ul s_index, predicate pred) const {
+                return detail::max_right(tree, size, length, s_index, monoid::identity(), combine, pred);
+            }
+
+            /**
+             * The mirror image of max_right, finds the furthest start of an interval ending at @e_index.
+             * @param e_index an end index of the interval (exclusive)
+             * @param pred a predicate over the accumulated values, pred(monoid::identity()) must be true
+             * and pred should be monotone
+             * @return the smallest s_index such that pred holds for the half open interval [s_index, e_index).
+             * Takes O(log(n)) time.
+             */
+            template<typename predicate>
+            ul min_left(ul e_index, predicate pred) const {
+                return detail::min_left(tree, size, length, e_index, monoid::identity(), combine, pred);
+            }
+
+            void print_leafs() const {
+                print_range(0, size);
+            }
+
+            /**
+             * Prints the tree structure level by level,
+             * starting from the root as the first line on the
+             * standard output stream.
+             */
+            void print_level_by_level() const {
+                for (ul level_size = 1; level_size <= size; level_size <<= 1) {
+                    print_range(0, level_size);
+                }
+            }
+
+            data_type get_leaf_value(const ul index) const {
+                is_in_leaf_bounds(index);
+
+                return tree[index + size];
+            }
+
+            data_type get_root_value() const {
+                return tree[1];
+            }
+
+            data_type get_node_value(const ul index) const {
+                return tree[index];
+            }
+
+            /**
+             * @return the number of leafs in a tree (@desirable_size rounded up to the power of two)
+             */
+            ul leaf_count() const noexcept {
+                return size;
+            }
+
+            /**
+             * @return the number of nodes allocated, always 2 * leaf_count()
+             */
+            ul node_count() const noexcept {
+                return tree.size();
+            }
+
+        protected:
+            ul size = 1; // the number of leafs, a power of two
+            ul length; // the number of elements the tree was created for, max_right and min_left stay within it
+            std::vector<data_type> tree; // a root is stored at index 1
+            monoid combine;
+
+        private:
+            ul left_child(const ul node) const noexcept {
+                return 2 * node;
+            }
+
+            ul right_child(const ul node) const noexcept {
+                return 2 * node + 1;
+            }
+
+            void pull(const ul node) {
+                tree[node] = combine(tree[left_child(node)], tree[right_child(node)]);
+            }
+
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            void print_range(const ul start, const ul end) const {
+                for (ul index = start; index < end; ++index) {
+                    std::cout << tree[index + end] << " ";
+                }
+
+                std::cout << std::endl;
+            }
+        };
+    }
+}
+
+#endif //SRC_MONOID_SEGMENT_TREE_H
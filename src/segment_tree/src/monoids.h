@@ -0,0 +1,99 @@
+#ifndef SRC_MONOIDS_H
+#define SRC_MONOIDS_H
+
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+namespace algo_lib {
+    namespace tree {
+        /**
+         * Combiner policies for the segment trees that are parametrised at compile time.
+         *
+         * Every monoid provides:
+         *  - static identity() - the neutral element of the operation, known at compile time,
+         *  - operator()(lhs, rhs) - an associative combine, the left argument is an accumulator.
+         *
+         * The combine is an ordinary member function (not a std::function), so the compiler
+         * is free to inline it into the loops that climb the tree.
+         *
+         * A monoid may also declare static constexpr bool commutative = true,
+         * which allows the trees to combine the elements in any order (see is_commutative),
+         * and static constexpr bool idempotent = true when combine(x, x) == x,
+         * which allows the overlapping intervals to be combined (see is_idempotent).
+         */
+        namespace monoids {
+            template<typename data_type>
+            struct plus {
+                static constexpr bool commutative = true;
+
+                static constexpr data_type identity() noexcept {
+                    return data_type(0);
+                }
+
+                constexpr data_type operator()(const data_type &lhs, const data_type &rhs) const {
+                    return lhs + rhs;
+                }
+            };
+
+            template<typename data_type>
+            struct min {
+                static constexpr bool commutative = true;
+                static constexpr bool idempotent = true;
+
+                static constexpr data_type identity() noexcept {
+                    return std::numeric_limits<data_type>::max();
+                }
+
+                constexpr data_type operator()(const data_type &lhs, const data_type &rhs) const {
+                    return std::min(lhs, rhs);
+                }
+            };
+
+            template<typename data_type>
+            struct max {
+                static constexpr bool commutative = true;
+                static constexpr bool idempotent = true;
+
+                static constexpr data_type identity() noexcept {
+                    return std::numeric_limits<data_type>::lowest();
+                }
+
+                constexpr data_type operator()(const data_type &lhs, const data_type &rhs) const {
+                    return std::max(lhs, rhs);
+                }
+            };
+
+            template<typename data_type>
+            struct gcd {
+                static constexpr bool commutative = true;
+                static constexpr bool idempotent = true;
+
+                static constexpr data_type identity() noexcept {
+                    return data_type(0);
+                }
+
+                constexpr data_type operator()(const data_type &lhs, const data_type &rhs) const {
+                    return std::gcd(lhs, rhs);
+                }
+            };
+
+            template<typename monoid, typename = void>
+            struct is_commutative : std::false_type {};
+
+            template<typename monoid>
+            struct is_commutative<monoid, std::void_t<decltype(monoid::commutative)>>
+                    : std::bool_constant<monoid::commutative> {};
+
+            template<typename monoid, typename = void>
+            struct is_idempotent : std::false_type {};
+
+            template<typename monoid>
+            struct is_idempotent<monoid, std::void_t<decltype(monoid::idempotent)>>
+                    : std::bool_constant<monoid::idempotent> {};
+        }
+    }
+}
+
+#endif //SRC_MONOIDS_H
@@ -0,0 +1,189 @@
+#ifndef SRC_MULTI_LANE_SEGMENT_TREE_H
+#define SRC_MULTI_LANE_SEGMENT_TREE_H
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * A segment tree which keeps k independent layers (lanes) over the same leafs.
+         * @tparam data_type a type of elements stored in a tree (copy assignable and copy constructible)
+         * @tparam monoid a combiner policy, see monoids.h
+         *
+         * It behaves as k separate monoid_segment_tree objects, but all of the k values of a node
+         * are stored contiguously, so a single traversal updates (or queries) every lane at once
+         * and the inner loops over the lanes are plain element-wise loops the compiler can vectorise.
+         * The layout is the same heap as in the tree::segment_tree, node i occupies
+         * (i * k, ... , i * k + k - 1) positions.
+         */
+        template<typename data_type, typename monoid = monoids::plus<data_type>>
+        class multi_lane_segment_tree {
+            static_assert(std::is_copy_assignable<data_type>::value && std::is_copy_constructible<data_type>::value);
+
+        public:
+            multi_lane_segment_tree(const ul desirable_size, const ul lane_count, const monoid combiner = monoid())
+                    : k(lane_count), combine(combiner) {
+                if (desirable_size < 1 || lane_count < 1) {
+                    throw std::out_of_range("Size of a tree and the number of lanes should exceed 1.");
+                }
+
+                while (size < desirable_size) {
+                    size <<= 1;
+                }
+
+                tree.resize((size << (ul) 1) * k, monoid::identity());
+            }
+
+            /**
+             * Updates every lane of the leaf, and traverses the tree to the top once.
+             * @param leaf_index an index of a leaf to be updated
+             * @param updaters lanes() new values to combine with the previous ones, one per lane
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with an updater
+             */
+            template<typename update_fn>
+            void update_leaf(ul leaf_index, const data_type *updaters, update_fn result_function) {
+                is_in_leaf_bounds(leaf_index);
+
+                leaf_index += size;
+                data_type *leaf = node(leaf_index);
+                for (ul lane = 0; lane < k; ++lane) {
+                    leaf[lane] = result_function(leaf[lane], updaters[lane]);
+                }
+
+                for (leaf_index >>= 1; leaf_index > 0; leaf_index >>= 1) {
+                    data_type *parent = node(leaf_index);
+                    const data_type *left = node(2 * leaf_index);
+                    const data_type *right = node(2 * leaf_index + 1);
+
+                    for (ul lane = 0; lane < k; ++lane) {
+                        parent[lane] = combine(left[lane], right[lane]);
+                    }
+                }
+            }
+
+            void leaf_update(const ul leaf_index, const data_type *updaters) {
+                update_leaf(leaf_index, updaters, combine);
+            }
+
+            void set_leaf(const ul leaf_index, const data_type *values) {
+                update_leaf(leaf_index, values, [](const data_type &, const data_type &v) { return v; });
+            }
+
+            /**
+             * Combines the leafs in [s_index, e_index] (inclusive) in every lane in a single traversal.
+             * @param result lanes() elements, the aggregate of a lane i is written to result[i]
+             */
+            void iterative_query(ul s_index, ul e_index, data_type *result) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+
+                std::fill(result, result + k, monoid::identity());
+
+                // for commutative monoids a single accumulator per lane is enough
+                std::vector<data_type> right_result;
+                if constexpr (!monoids::is_commutative<monoid>::value) {
+                    right_result.assign(k, monoid::identity());
+                }
+
+                s_index += size;
+                e_index += size + 1;
+
+                while (s_index < e_index) {
+                    if (s_index & (ul) 1) {
+                        const data_type *values = node(s_index++);
+                        for (ul lane = 0; lane < k; ++lane) {
+                            result[lane] = combine(result[lane], values[lane]);
+                        }
+                    }
+
+                    if (e_index & (ul) 1) {
+                        const data_type *values = node(--e_index);
+                        if constexpr (monoids::is_commutative<monoid>::value) {
+                            for (ul lane = 0; lane < k; ++lane) {
+                                result[lane] = combine(result[lane], values[lane]);
+                            }
+                        } else {
+                            for (ul lane = 0; lane < k; ++lane) {
+                                right_result[lane] = combine(values[lane], right_result[lane]);
+                            }
+                        }
+                    }
+
+                    s_index >>= 1;
+                    e_index >>= 1;
+                }
+
+                if constexpr (!monoids::is_commutative<monoid>::value) {
+                    for (ul lane = 0; lane < k; ++lane) {
+                        result[lane] = combine(result[lane], right_result[lane]);
+                    }
+                }
+            }
+
+            std::vector<data_type> iterative_query(const ul s_index, const ul e_index) const {
+                std::vector<data_type> result(k);
+                iterative_query(s_index, e_index, result.data());
+
+                return result;
+            }
+
+            data_type get_leaf_value(const ul index, const ul lane) const {
+                is_in_leaf_bounds(index);
+                is_in_lane_bounds(lane);
+
+                return node(index + size)[lane];
+            }
+
+            data_type get_root_value(const ul lane) const {
+                is_in_lane_bounds(lane);
+
+                return node(1)[lane];
+            }
+
+            ul lanes() const noexcept {
+                return k;
+            }
+
+            ul leaf_count() const noexcept {
+                return size;
+            }
+
+        private:
+            data_type *node(const ul index) {
+                return tree.data() + index * k;
+            }
+
+            const data_type *node(const ul index) const {
+                return tree.data() + index * k;
+            }
+
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            void is_in_lane_bounds(const ul lane) const {
+                if (lane >= k) {
+                    throw std::out_of_range("Provided lane is out of range.");
+                }
+            }
+
+            ul size = 1;
+            ul k; // the number of lanes
+            std::vector<data_type> tree; // a root is stored at index 1, every node takes k elements
+            monoid combine;
+        };
+    }
+}
+
+#endif //SRC_MULTI_LANE_SEGMENT_TREE_H
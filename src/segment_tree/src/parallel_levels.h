@@ -0,0 +1,148 @@
+#ifndef SRC_PARALLEL_LEVELS_H
+#define SRC_PARALLEL_LEVELS_H
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        namespace detail {
+            /**
+             * A reusable barrier, every thread waits until all of them have arrived.
+             */
+            class barrier {
+            public:
+                explicit barrier(const unsigned count)
+                        : count(count), waiting(0), generation(0) {}
+
+                void arrive_and_wait() {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    const unsigned long arrived_in = generation;
+
+                    if (++waiting == count) {
+                        waiting = 0;
+                        ++generation;
+                        all_arrived.notify_all();
+                        return;
+                    }
+
+                    all_arrived.wait(lock, [this, arrived_in] { return generation != arrived_in; });
+                }
+
+            private:
+                std::mutex mutex;
+                std::condition_variable all_arrived;
+                const unsigned count;
+                unsigned waiting;
+                unsigned long generation;
+            };
+
+            /**
+             * @brief Collects the ancestors of the given leafs, level by level up to the root.
+             * @param leafs positions of the leafs in a heap layout with @size leafs (duplicates are allowed)
+             * @param size the number of leafs in a tree, a power of two
+             * @return a list of distinct nodes for every level, starting from the parents of the leafs
+             *
+             * A small batch (k leafs, k * 64 < size) is sorted once, then every level is made of
+             * the parents of the previous one, which are already in order, so the duplicates
+             * are adjacent and dropped by std::unique. It takes O(k * (log(k) + log(size))) time
+             * and nothing proportional to the size of a tree is allocated.
+             *
+             * For a larger batch a bitmap of the visited nodes (size / 8 bytes) is cheaper than sorting,
+             * a climb from a leaf stops at the first ancestor that is already collected,
+             * so it takes O(size / 64 + number of distinct ancestors) time.
+             */
+            inline std::vector<std::vector<ul>> dirty_levels(const std::vector<ul> &leafs, const ul size) {
+                std::vector<std::vector<ul>> levels;
+                if (leafs.empty()) {
+                    return levels;
+                }
+
+                if (leafs.size() < size / 64) {
+                    std::vector<ul> level(leafs);
+                    std::sort(level.begin(), level.end());
+
+                    for (ul width = size >> 1; width > 0; width >>= 1) {
+                        for (ul &node : level) {
+                            node >>= 1;
+                        }
+
+                        level.erase(std::unique(level.begin(), level.end()), level.end());
+                        levels.push_back(level);
+                    }
+
+                    return levels;
+                }
+
+                for (ul width = size >> 1; width > 0; width >>= 1) {
+                    levels.emplace_back();
+                }
+
+                std::vector<bool> collected(size, false);
+                for (const ul leaf : leafs) {
+                    ul depth = 0;
+                    for (ul node = leaf >> 1; node > 0 && !collected[node]; node >>= 1, ++depth) {
+                        collected[node] = true;
+                        levels[depth].push_back(node);
+                    }
+                }
+
+                return levels;
+            }
+
+            /**
+             * @brief Calls @fn for every node of every level, the levels are processed in order
+             * and the nodes of a single level are split evenly between the threads.
+             * @param levels nodes of every level, no two nodes of a level can depend on each other
+             * @param threads the number of threads, the calling thread is one of them
+             *
+             * The threads - 1 helper threads are started and joined on every call (there is no pool),
+             * which costs tens of microseconds, so more than one thread pays off for large batches only.
+             */
+            template<typename Fn>
+            void for_each_level(const std::vector<std::vector<ul>> &levels, const unsigned threads, Fn fn) {
+                if (threads <= 1) {
+                    for (const auto &level : levels) {
+                        for (const ul node : level) {
+                            fn(node);
+                        }
+                    }
+
+                    return;
+                }
+
+                barrier level_done(threads);
+                auto worker = [&levels, &level_done, &fn, threads](const unsigned id) {
+                    for (const auto &level : levels) {
+                        const ul chunk = (level.size() + threads - 1) / threads;
+                        const ul from = std::min<ul>(level.size(), id * chunk);
+                        const ul to = std::min<ul>(level.size(), from + chunk);
+
+                        for (ul i = from; i < to; ++i) {
+                            fn(level[i]);
+                        }
+
+                        level_done.arrive_and_wait();
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                for (unsigned id = 1; id < threads; ++id) {
+                    workers.emplace_back(worker, id);
+                }
+
+                worker(0);
+                for (auto &w : workers) {
+                    w.join();
+                }
+            }
+        }
+    }
+}
+
+#endif //SRC_PARALLEL_LEVELS_H
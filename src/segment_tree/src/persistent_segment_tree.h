@@ -0,0 +1,239 @@
+#ifndef SRC_PERSISTENT_SEGMENT_TREE_H
+#define SRC_PERSISTENT_SEGMENT_TREE_H
+
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <limits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * A persistent (path copying) segment tree, every update creates a new version of a tree
+         * and leaves all of the previous ones intact, so any of them can be queried later.
+         * @tparam data_type a type of elements stored in a tree (copy assignable and copy constructible)
+         * @tparam monoid a combiner policy, see monoids.h
+         *
+         * The nodes live in a single arena (a vector which only grows) and link their children
+         * with 32 bit indexes. An update copies the O(log(n)) nodes on the path from the root
+         * to the leaf and shares all of the remaining subtrees with the previous version.
+         *
+         * The node at index 0 is an 'empty' subtree: its value is the identity
+         * and both of its children are itself, thus the initial version takes O(1) memory.
+         */
+        template<typename data_type, typename monoid = monoids::plus<data_type>>
+        class persistent_segment_tree {
+            static_assert(std::is_copy_assignable<data_type>::value && std::is_copy_constructible<data_type>::value);
+
+        public:
+            using index_type = std::uint32_t;
+            using version = index_type; ///< a handle of a version, it is an index of its root in the arena
+
+            explicit persistent_segment_tree(const ul desirable_size, const monoid combiner = monoid())
+                    : size(desirable_size), combine(combiner) {
+                if (desirable_size < 1) {
+                    throw std::out_of_range("Size of a tree should exceed 1.");
+                }
+
+                nodes.push_back({monoid::identity(), empty, empty});
+            }
+
+            /**
+             * @return a version with every leaf equal to the identity
+             */
+            version initial() const noexcept {
+                return empty;
+            }
+
+            /**
+             * Creates a new version with the leafs initialised from [first, last),
+             * the remaining leafs are equal to the identity. Takes O(n) time and memory.
+             */
+            template<typename ForwardIterator>
+            version build(ForwardIterator first, ForwardIterator last) {
+                const ul count = (ul) std::distance(first, last);
+                if (count > size) {
+                    throw std::out_of_range("Provided range exceeds the size of a tree.");
+                }
+
+                std::vector<data_type> leafs(first, last);
+                return build_range(leafs, 0, size - 1);
+            }
+
+            /**
+             * Creates a new version in which the leaf is combined with @updater.
+             * @param from a version to update, it stays unchanged
+             * @param leaf_index an index of a leaf to be updated
+             * @param updater a new value to combine with the previous one
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with @updater
+             * @return a handle of the new version
+             */
+            template<typename update_fn>
+            version update_leaf(const version from, const ul leaf_index, const data_type updater,
+                                update_fn result_function) {
+                is_in_leaf_bounds(leaf_index);
+
+                index_type path[std::numeric_limits<ul>::digits + 1];
+                bool went_right[std::numeric_limits<ul>::digits + 1];
+                ul depth = 0, low = 0, high = size - 1;
+                index_type node = from;
+
+                while (low < high) {
+                    const ul middle = low + (high - low) / 2;
+                    path[depth] = node;
+                    went_right[depth] = leaf_index > middle;
+
+                    if (went_right[depth]) {
+                        node = nodes[node].right;
+                        low = middle + 1;
+                    } else {
+                        node = nodes[node].left;
+                        high = middle;
+                    }
+                    ++depth;
+                }
+
+                index_type current = allocate({result_function(nodes[node].value, updater), empty, empty});
+                while (depth-- > 0) {
+                    const node_type &parent = nodes[path[depth]];
+                    const index_type left = went_right[depth] ? parent.left : current;
+                    const index_type right = went_right[depth] ? current : parent.right;
+
+                    current = allocate({combine(nodes[left].value, nodes[right].value), left, right});
+                }
+
+                return current;
+            }
+
+            version leaf_update(const version from, const ul leaf_index, const data_type updater) {
+                return update_leaf(from, leaf_index, updater, combine);
+            }
+
+            version set_leaf(const version from, const ul leaf_index, const data_type value) {
+                return update_leaf(from, leaf_index, value, [](const data_type &, const data_type &v) { return v; });
+            }
+
+            /**
+             * Combines all of the leafs in [s_index, e_index] (inclusive) as of the given version.
+             */
+            data_type iterative_query(const version at, const ul s_index, const ul e_index) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+
+                struct frame {
+                    index_type node;
+                    ul low, high;
+                };
+
+                // the right child is pushed first, so the intervals are combined from left to right,
+                // the stack never holds more than one frame per level plus one
+                frame stack[std::numeric_limits<ul>::digits + 2];
+                ul top = 0;
+                stack[top++] = {at, 0, size - 1};
+                data_type result = monoid::identity();
+
+                while (top > 0) {
+                    const frame f = stack[--top];
+
+                    if (f.high < s_index || e_index < f.low) {
+                        continue;
+                    }
+
+                    if (s_index <= f.low && f.high <= e_index) {
+                        result = combine(result, nodes[f.node].value);
+                        continue;
+                    }
+
+                    const ul middle = f.low + (f.high - f.low) / 2;
+                    stack[top++] = {nodes[f.node].right, middle + 1, f.high};
+                    stack[top++] = {nodes[f.node].left, f.low, middle};
+                }
+
+                return result;
+            }
+
+            data_type get_leaf_value(const version at, const ul index) const {
+                return iterative_query(at, index, index);
+            }
+
+            data_type get_root_value(const version at) const {
+                return nodes[at].value;
+            }
+
+            /**
+             * Preallocates the arena, f.e. for the known number of updates multiplied by the height.
+             */
+            void reserve(const ul node_count) {
+                nodes.reserve(node_count);
+            }
+
+            /**
+             * @return the number of nodes in the arena (shared by all of the versions)
+             */
+            ul node_count() const noexcept {
+                return nodes.size();
+            }
+
+            ul leaf_count() const noexcept {
+                return size;
+            }
+
+        private:
+            struct node_type {
+                data_type value;
+                index_type left;
+                index_type right;
+            };
+
+            static constexpr index_type empty = 0;
+
+            /**
+             * Bump allocation in the arena.
+             */
+            index_type allocate(const node_type &node) {
+                if (nodes.size() > std::numeric_limits<index_type>::max()) {
+                    throw std::length_error("Arena of a persistent tree is full.");
+                }
+
+                nodes.push_back(node);
+                return (index_type) (nodes.size() - 1);
+            }
+
+            index_type build_range(const std::vector<data_type> &leafs, const ul low, const ul high) {
+                if (low >= leafs.size()) {
+                    return empty;
+                }
+
+                if (low == high) {
+                    return allocate({leafs[low], empty, empty});
+                }
+
+                const ul middle = low + (high - low) / 2;
+                const index_type left = build_range(leafs, low, middle);
+                const index_type right = build_range(leafs, middle + 1, high);
+
+                return allocate({combine(nodes[left].value, nodes[right].value), left, right});
+            }
+
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            ul size;
+            std::vector<node_type> nodes; // the arena
+            monoid combine;
+        };
+    }
+}
+
+#endif //SRC_PERSISTENT_SEGMENT_TREE_H
@@ -2,9 +2,15 @@
 #define SRC_SEGMENT_TREE_H
 
 #include <vector>
+#include <algorithm>
 #include <functional>
 #include <cassert>
 #include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+#include "heap_algorithms.h"
 
 namespace algo_lib {
     namespace tree {
@@ -59,7 +65,7 @@ namespace algo_lib {
             segment_tree(const ul desirable_size,
                          data_type default_value,
                          const tree_builder_fn default_function)
-                    : default_argument(default_value), default_function(default_function) {
+                    : default_argument(default_value), length(desirable_size), default_function(default_function) {
                 if (desirable_size < 1) {
                     throw std::out_of_range("Size of a tree should exceed 1.");
                 }
@@ -71,6 +77,37 @@ namespace algo_lib {
                 tree.resize(size << (ul) 1, default_value);
             }
 
+            /**
+             * Constructs a tree with leafs initialised from [first, last), see build.
+             * @param first a forward iterator (indicating the beginning)
+             * @param last a forward iterator (indicating the end)
+             * @param threads the number of threads to build the tree with
+             */
+            template<typename ForwardIterator>
+            segment_tree(ForwardIterator first,
+                         ForwardIterator last,
+                         data_type default_value,
+                         const tree_builder_fn default_function,
+                         const unsigned threads = 1)
+                    : segment_tree((ul) std::distance(first, last), default_value, default_function) {
+                build(first, last, threads);
+            }
+
+            /**
+             * Replaces the leafs with the values from [first, last) (the remaining leafs are set
+             * to the default value) and calculates the internal levels bottom-up in O(n) time,
+             * instead of O(n * log(n)) taken by consecutive update_leaf calls.
+             * @param first a forward iterator (indicating the beginning)
+             * @param last a forward iterator (indicating the end)
+             * @param threads the number of threads to build the tree with, every thread builds
+             * a separate subtree and the levels above these subtrees are built by the calling thread.
+             * It pays off for the very large trees only.
+             */
+            template<typename ForwardIterator>
+            void build(ForwardIterator first, ForwardIterator last, const unsigned threads = 1) {
+                detail::build(tree, size, first, last, default_argument, default_function, threads);
+            }
+
             /**
              * Updates the leaf, and traverses the tree to the top.
              * Consequently updating all the values on its path.
@@ -101,6 +138,31 @@ namespace algo_lib {
                 update_leaf(leaf_index, updater, default_function);
             }
 
+            /**
+             * Applies a batch of leaf updates at once. All of the leafs are written first (in the order
+             * of @updates, so the repeated indexes are combined one after another), then only
+             * the ancestors of the updated leafs are recalculated, level by level, every one of them
+             * exactly once per batch.
+             * @param updates pairs of (leaf_index, updater)
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with an updater
+             * @param threads the number of threads every level is split between
+             */
+            template<typename update_fn,
+                    typename = std::enable_if_t<std::is_invocable<update_fn, data_type, data_type>::value>>
+            void apply_batch(const std::vector<std::pair<ul, data_type>> &updates,
+                             update_fn result_function,
+                             const unsigned threads = 1) {
+                detail::apply_batch(tree, size, updates, result_function, default_function, threads);
+            }
+
+            /**
+             * Applies a batch of updates combining them with default_function.
+             */
+            void apply_batch(const std::vector<std::pair<ul, data_type>> &updates, const unsigned threads = 1) {
+                apply_batch(updates, default_function, threads);
+            }
+
             /**
              * Iterates over a tree in a non-recursive manner, calculating @result_function
              * over all of the O(log(n)) intervals that [s_index, e_index] is being divided into.
@@ -150,6 +212,34 @@ namespace algo_lib {
                 return iterative_query(start_index, end_index, default_function);
             }
 
+            /**
+             * Descends the tree once to find the furthest end of an interval starting at @s_index
+             * for which @pred holds, f.e. the first index where the prefix sum exceeds some K.
+             * @param s_index a start index of the interval
+             * @param pred a predicate over the accumulated values, pred(default_argument) must be true
+             * and pred should be monotone (once false it stays false for longer intervals)
+             * @return the largest e_index such that pred holds for the half open interval [s_index, e_index),
+             * so it is the first index that makes pred false, or the number of elements if there is none.
+             * Takes O(log(n)) time.
+             */
+            template<typename predicate>
+            ul max_right(ul s_index, predicate pred) const {
+                return detail::max_right(tree, size, length, s_index, default_argument, default_function, pred);
+            }
+
+            /**
+             * The mirror image of max_right, finds the furthest start of an interval ending at @e_index.
+             * @param e_index an end index of the interval (exclusive)
+             * @param pred a predicate over the accumulated values, pred(default_argument) must be true
+             * and pred should be monotone
+             * @return the smallest s_index such that pred holds for the half open interval [s_index, e_index).
+             * Takes O(log(n)) time.
+             */
+            template<typename predicate>
+            ul min_left(ul e_index, predicate pred) const {
+                return detail::min_left(tree, size, length, e_index, default_argument, default_function, pred);
+            }
+
             void print_leafs() const {
                 print_range(0, size);
             }
@@ -171,7 +261,7 @@ namespace algo_lib {
             data_type get_leaf_value(const ul index) const override {
                 is_in_leaf_bounds(index);
 
-                return get_node_value(index);
+                return get_node_value(index + size);
             }
 
             /**
@@ -190,7 +280,8 @@ namespace algo_lib {
 
         protected:
             data_type default_argument;
-            ul size = 1;
+            ul size = 1; // the number of leafs, a power of two
+            ul length; // the number of elements the tree was created for, max_right and min_left stay within it
             std::vector<data_type> tree; // for convenience purposes a root is stores at index 1
             tree_builder_fn default_function;
 
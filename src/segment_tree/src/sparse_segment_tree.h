@@ -0,0 +1,208 @@
+#ifndef SRC_SPARSE_SEGMENT_TREE_H
+#define SRC_SPARSE_SEGMENT_TREE_H
+
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <limits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        /**
+         * A dynamic segment tree over a large coordinate space (up to the whole 64 bit range),
+         * only the nodes on the paths to the updated leafs are ever created.
+         * @tparam data_type a type of elements stored in a tree (copy assignable and copy constructible)
+         * @tparam monoid a combiner policy, see monoids.h
+         * @tparam key_type an unsigned integer type of the coordinates
+         *
+         * The nodes are kept in a pool (a vector which only grows) and link their children
+         * with 32 bit indexes, the index 0 is reserved for 'no node' which stands for a subtree
+         * with all of the leafs equal to the identity. Thus the memory is O(updates * log(U))
+         * rather than O(U), and no coordinate compression is needed.
+         */
+        template<typename data_type,
+                typename monoid = monoids::plus<data_type>,
+                typename key_type = std::uint64_t>
+        class sparse_segment_tree {
+            static_assert(std::is_copy_assignable<data_type>::value && std::is_copy_constructible<data_type>::value);
+            static_assert(std::is_unsigned<key_type>::value, "Coordinates should be of an unsigned type.");
+
+        public:
+            using index_type = std::uint32_t;
+
+            /**
+             * Creates a tree over the coordinates [min_key, max_key] (inclusive), no nodes are allocated.
+             */
+            explicit sparse_segment_tree(const key_type min_key = 0,
+                                         const key_type max_key = std::numeric_limits<key_type>::max(),
+                                         const monoid combiner = monoid())
+                    : low_key(min_key), high_key(max_key), combine(combiner) {
+                if (min_key > max_key) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+
+                nodes.push_back({monoid::identity(), none, none});
+            }
+
+            /**
+             * Updates the leaf at the @key, creating the missing nodes on the path.
+             * @param key a coordinate of a leaf to be updated
+             * @param updater a new value to combine with the previous one
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with @updater
+             */
+            template<typename update_fn>
+            void update_leaf(const key_type key, const data_type updater, update_fn result_function) {
+                is_in_leaf_bounds(key);
+
+                if (root == none) {
+                    root = allocate();
+                }
+
+                index_type path[std::numeric_limits<key_type>::digits + 1];
+                ul depth = 0;
+                key_type low = low_key, high = high_key;
+                index_type node = root;
+
+                while (low < high) {
+                    path[depth++] = node;
+                    const key_type middle = low + (high - low) / 2;
+
+                    if (key > middle) {
+                        node = child(node, false);
+                        low = middle + 1;
+                    } else {
+                        node = child(node, true);
+                        high = middle;
+                    }
+                }
+
+                nodes[node].value = result_function(nodes[node].value, updater);
+
+                while (depth-- > 0) {
+                    node_type &parent = nodes[path[depth]];
+                    parent.value = combine(nodes[parent.left].value, nodes[parent.right].value);
+                }
+            }
+
+            void leaf_update(const key_type key, const data_type updater) {
+                update_leaf(key, updater, combine);
+            }
+
+            void set_leaf(const key_type key, const data_type value) {
+                update_leaf(key, value, [](const data_type &, const data_type &v) { return v; });
+            }
+
+            /**
+             * Combines all of the leafs in [s_key, e_key] (inclusive), the subtrees which
+             * were never created are skipped, since they consist of the identities only.
+             */
+            data_type iterative_query(const key_type s_key, const key_type e_key) const {
+                if (s_key > e_key) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(s_key);
+                is_in_leaf_bounds(e_key);
+
+                struct frame {
+                    index_type node;
+                    key_type low, high;
+                };
+
+                // the right child is pushed first, so the intervals are combined from left to right
+                frame stack[std::numeric_limits<key_type>::digits + 2];
+                ul top = 0;
+                stack[top++] = {root, low_key, high_key};
+                data_type result = monoid::identity();
+
+                while (top > 0) {
+                    const frame f = stack[--top];
+
+                    if (f.node == none || f.high < s_key || e_key < f.low) {
+                        continue;
+                    }
+
+                    if (s_key <= f.low && f.high <= e_key) {
+                        result = combine(result, nodes[f.node].value);
+                        continue;
+                    }
+
+                    const key_type middle = f.low + (f.high - f.low) / 2;
+                    stack[top++] = {nodes[f.node].right, middle + 1, f.high};
+                    stack[top++] = {nodes[f.node].left, f.low, middle};
+                }
+
+                return result;
+            }
+
+            data_type get_leaf_value(const key_type key) const {
+                return iterative_query(key, key);
+            }
+
+            data_type get_root_value() const {
+                return nodes[root].value;
+            }
+
+            void reserve(const ul node_count) {
+                nodes.reserve(node_count);
+            }
+
+            /**
+             * @return the number of nodes allocated in the pool (the reserved 'no node' included)
+             */
+            ul node_count() const noexcept {
+                return nodes.size();
+            }
+
+        private:
+            struct node_type {
+                data_type value;
+                index_type left;
+                index_type right;
+            };
+
+            static constexpr index_type none = 0;
+
+            index_type allocate() {
+                if (nodes.size() > std::numeric_limits<index_type>::max()) {
+                    throw std::length_error("Node pool of a sparse tree is full.");
+                }
+
+                nodes.push_back({monoid::identity(), none, none});
+                return (index_type) (nodes.size() - 1);
+            }
+
+            /**
+             * @return the left (or the right) child of a node, creating it if it does not exist
+             */
+            index_type child(const index_type node, const bool left) {
+                index_type existing = left ? nodes[node].left : nodes[node].right;
+                if (existing != none) {
+                    return existing;
+                }
+
+                existing = allocate(); // may reallocate the pool, so the node is looked up again below
+                (left ? nodes[node].left : nodes[node].right) = existing;
+
+                return existing;
+            }
+
+            void is_in_leaf_bounds(const key_type key) const {
+                if (key < low_key || high_key < key) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            key_type low_key, high_key;
+            index_type root = none;
+            std::vector<node_type> nodes; // the pool
+            monoid combine;
+        };
+    }
+}
+
+#endif //SRC_SPARSE_SEGMENT_TREE_H
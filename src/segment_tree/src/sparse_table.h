@@ -0,0 +1,126 @@
+#ifndef SRC_SPARSE_TABLE_H
+#define SRC_SPARSE_TABLE_H
+
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        namespace detail {
+            /**
+             * @return floor(log2(@value)), @value has to be positive
+             */
+            inline ul floor_log2(const ul value) noexcept {
+#if defined(__GNUC__)
+                return (ul) (sizeof(ul) * 8 - 1 - __builtin_clzl(value));
+#else
+                ul result = 0;
+                while ((value >> result) > 1) {
+                    ++result;
+                }
+                return result;
+#endif
+            }
+        }
+
+        /**
+         * A static structure for the range queries over an immutable array, answering
+         * every query in O(1) after O(n * log(n)) construction.
+         * @tparam data_type a type of elements stored in a table (copy assignable and copy constructible)
+         * @tparam monoid an idempotent combiner policy (f.e. min, max or gcd), see monoids.h
+         *
+         * The level k of a table keeps the aggregates of all of the intervals of length 2^k.
+         * Any interval is the union of two (possibly overlapping) intervals of the same
+         * power of two length, which is why the monoid has to be idempotent.
+         *
+         * It shares the query interface with the segment trees (iterative_query, get_leaf_value,
+         * get_root_value), so it can replace a tree which is never updated after being built.
+         */
+        template<typename data_type, typename monoid = monoids::min<data_type>>
+        class sparse_table {
+            static_assert(monoids::is_idempotent<monoid>::value,
+                          "A sparse table answers the queries with overlapping intervals, so the monoid has to be idempotent.");
+
+        public:
+            /**
+             * Builds a table from [first, last) in O(n * log(n)) time.
+             * @param first a forward iterator (indicating the beginning)
+             * @param last a forward iterator (indicating the end)
+             */
+            template<typename ForwardIterator>
+            sparse_table(ForwardIterator first, ForwardIterator last, const monoid combiner = monoid())
+                    : size((ul) std::distance(first, last)), combine(combiner) {
+                if (size < 1) {
+                    throw std::out_of_range("Size of a table should exceed 1.");
+                }
+
+                const ul levels = detail::floor_log2(size) + 1;
+                ul total = 0;
+                for (ul level = 0; level < levels; ++level) {
+                    offsets.push_back(total);
+                    total += size - ((ul) 1 << level) + 1;
+                }
+
+                table.reserve(total);
+                table.assign(first, last);
+
+                for (ul level = 1; level < levels; ++level) {
+                    const ul half = (ul) 1 << (level - 1);
+                    const ul below = offsets[level - 1];
+
+                    for (ul i = 0; i + (half << 1) <= size; ++i) {
+                        table.push_back(combine(table[below + i], table[below + i + half]));
+                    }
+                }
+            }
+
+            /**
+             * Combines all of the elements in [s_index, e_index] (inclusive) in O(1) time.
+             */
+            data_type iterative_query(const ul s_index, const ul e_index) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+
+                const ul level = detail::floor_log2(e_index - s_index + 1);
+                const data_type *row = table.data() + offsets[level];
+
+                return combine(row[s_index], row[e_index + 1 - ((ul) 1 << level)]);
+            }
+
+            data_type get_leaf_value(const ul index) const {
+                is_in_leaf_bounds(index);
+
+                return table[index];
+            }
+
+            data_type get_root_value() const {
+                return iterative_query(0, size - 1);
+            }
+
+            ul leaf_count() const noexcept {
+                return size;
+            }
+
+        private:
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            ul size;
+            std::vector<data_type> table; // all of the levels, one after another
+            std::vector<ul> offsets; // an index of the first element of every level
+            monoid combine;
+        };
+    }
+}
+
+#endif //SRC_SPARSE_TABLE_H
@@ -0,0 +1,296 @@
+#ifndef SRC_WIDE_SEGMENT_TREE_H
+#define SRC_WIDE_SEGMENT_TREE_H
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "monoids.h"
+
+namespace algo_lib {
+    namespace tree {
+        using ul = unsigned long;
+
+        namespace detail {
+            constexpr ul cache_line = 64;
+
+            /**
+             * @return the number of @data_type elements which fit into a cache line (but at least 2)
+             */
+            template<typename data_type>
+            constexpr ul cache_line_fanout() {
+                return cache_line / sizeof(data_type) >= 2 ? cache_line / sizeof(data_type) : 2;
+            }
+        }
+
+        /**
+         * A B-ary segment tree, the children of every node are stored contiguously
+         * in a single block aligned to the cache line.
+         * @tparam data_type a type of elements stored in a tree (default constructible and copy assignable)
+         * @tparam monoid a combiner policy, see monoids.h
+         * @tparam fanout the number of children of every node, a power of two,
+         * by default as many elements as fit into a cache line
+         *
+         * The tree is stored level by level, starting from the leafs. The value at the index i
+         * of the level k + 1 is the aggregate of the block (i * fanout, ... , (i + 1) * fanout - 1)
+         * of the level k, so the height of a tree is log_fanout(n) instead of log_2(n)
+         * and every level costs a single cache miss.
+         *
+         * For commutative monoids over arithmetic types the blocks are reduced pairwise
+         * (element i with element i + width, halving the width), every step is an element-wise
+         * combine of two contiguous arrays which the compiler turns into SIMD instructions
+         * (the best results are with -O3 and -march set to the target).
+         * Other monoids are reduced sequentially, from left to right.
+         */
+        template<typename data_type,
+                typename monoid = monoids::plus<data_type>,
+                ul fanout = detail::cache_line_fanout<data_type>()>
+        class wide_segment_tree {
+            static_assert(fanout >= 2 && (fanout & (fanout - 1)) == 0, "Fanout should be a power of two.");
+            static_assert(std::is_default_constructible<data_type>::value && std::is_copy_assignable<data_type>::value);
+
+            struct alignas(detail::cache_line) block {
+                data_type values[fanout];
+            };
+
+        public:
+            explicit wide_segment_tree(const ul desirable_size, const monoid combiner = monoid())
+                    : size(desirable_size), combine(combiner) {
+                if (desirable_size < 1) {
+                    throw std::out_of_range("Size of a tree should exceed 1.");
+                }
+
+                ul values = size, blocks = 0;
+                while (true) {
+                    offsets.push_back(blocks);
+                    blocks += blocks_for(values);
+
+                    if (values <= fanout) {
+                        break;
+                    }
+                    values = blocks_for(values);
+                }
+
+                tree.resize(blocks);
+                for (auto &b : tree) {
+                    std::fill(std::begin(b.values), std::end(b.values), monoid::identity());
+                }
+            }
+
+            /**
+             * Constructs a tree with leafs initialised from [first, last), see build.
+             */
+            template<typename ForwardIterator>
+            wide_segment_tree(ForwardIterator first, ForwardIterator last, const monoid combiner = monoid())
+                    : wide_segment_tree((ul) std::distance(first, last), combiner) {
+                build(first, last);
+            }
+
+            /**
+             * Replaces the leafs with the values from [first, last) (the remaining leafs are set
+             * to the identity) and calculates the upper levels in O(n) time.
+             */
+            template<typename ForwardIterator>
+            void build(ForwardIterator first, ForwardIterator last) {
+                if ((ul) std::distance(first, last) > size) {
+                    throw std::out_of_range("Provided range exceeds the size of a tree.");
+                }
+
+                ul index = 0;
+                for (; first != last; ++first, ++index) {
+                    value(0, index) = *first;
+                }
+                for (; index < size; ++index) {
+                    value(0, index) = monoid::identity();
+                }
+
+                for (ul level = 0; level + 1 < offsets.size(); ++level) {
+                    for (ul b = 0; b < offsets[level + 1] - offsets[level]; ++b) {
+                        value(level + 1, b) = reduce(level, b, 0, fanout);
+                    }
+                }
+            }
+
+            /**
+             * Updates the leaf and recalculates one value on every level above it.
+             * @param leaf_index an index of a node to be updated
+             * @param updater a new value to combine with the previous one
+             * @param result_function tells the function how to combine the previous
+             * value in a leaf with @updater
+             */
+            template<typename update_fn>
+            void update_leaf(ul leaf_index, const data_type updater, update_fn result_function) {
+                is_in_leaf_bounds(leaf_index);
+
+                data_type current = result_function(value(0, leaf_index), updater);
+                for (ul level = 0; level + 1 < offsets.size(); ++level) {
+                    // the block is read before the new value is stored into it,
+                    // so the (vector) load does not wait for the (scalar) store
+                    const data_type parent = reduce_replacing(level, leaf_index, current);
+                    value(level, leaf_index) = current;
+
+                    current = parent;
+                    leaf_index /= fanout;
+                }
+
+                value(offsets.size() - 1, leaf_index) = current;
+            }
+
+            void leaf_update(const ul leaf_index, const data_type updater) {
+                update_leaf(leaf_index, updater, combine);
+            }
+
+            void set_leaf(const ul leaf_index, const data_type new_value) {
+                update_leaf(leaf_index, new_value, [](const data_type &, const data_type &v) { return v; });
+            }
+
+            /**
+             * Combines all of the leafs in [s_index, e_index] (inclusive). On every level
+             * at most two partial blocks are reduced, then both indexes move to the level above.
+             */
+            data_type iterative_query(ul s_index, ul e_index) const {
+                if (s_index > e_index) {
+                    throw std::out_of_range("Indexes are overlapping, a start is greater than the end.");
+                }
+                is_in_leaf_bounds(e_index);
+
+                data_type left_result = monoid::identity();
+                data_type right_result = monoid::identity();
+
+                for (ul level = 0;; ++level) {
+                    const ul s_block = s_index / fanout, e_block = e_index / fanout;
+
+                    if (s_block == e_block) {
+                        left_result = combine(left_result,
+                                              reduce(level, s_block, s_index % fanout, e_index % fanout + 1));
+                        break;
+                    }
+
+                    left_result = combine(left_result, reduce(level, s_block, s_index % fanout, fanout));
+                    right_result = combine(reduce(level, e_block, 0, e_index % fanout + 1), right_result);
+
+                    if (s_block + 1 > e_block - 1) {
+                        break;
+                    }
+                    s_index = s_block + 1;
+                    e_index = e_block - 1;
+                }
+
+                return combine(left_result, right_result);
+            }
+
+            data_type get_leaf_value(const ul index) const {
+                is_in_leaf_bounds(index);
+
+                return value(0, index);
+            }
+
+            data_type get_root_value() const {
+                return reduce(offsets.size() - 1, 0, 0, fanout);
+            }
+
+            ul leaf_count() const noexcept {
+                return size;
+            }
+
+            /**
+             * @return the number of levels, the root block included
+             */
+            ul height() const noexcept {
+                return offsets.size();
+            }
+
+        private:
+            static ul blocks_for(const ul values) noexcept {
+                return (values + fanout - 1) / fanout;
+            }
+
+            data_type &value(const ul level, const ul index) {
+                return tree[offsets[level] + index / fanout].values[index % fanout];
+            }
+
+            const data_type &value(const ul level, const ul index) const {
+                return tree[offsets[level] + index / fanout].values[index % fanout];
+            }
+
+            /**
+             * Combines the elements [from, to) of a block at the given level.
+             */
+            data_type reduce(const ul level, const ul block_index, const ul from, const ul to) const {
+                const data_type *values = tree[offsets[level] + block_index].values;
+
+                if constexpr (monoids::is_commutative<monoid>::value && std::is_arithmetic<data_type>::value) {
+                    if (from == 0 && to == fanout) {
+                        alignas(detail::cache_line) data_type buffer[fanout];
+                        std::copy(values, values + fanout, buffer);
+                        fold_halves<fanout / 2>(buffer);
+
+                        return buffer[0];
+                    }
+                }
+
+                data_type result = monoid::identity();
+                for (ul i = from; i < to; ++i) {
+                    result = combine(result, values[i]);
+                }
+
+                return result;
+            }
+
+            /**
+             * Combines the whole block which contains the element @index of the given level,
+             * as if that element was equal to @replacement.
+             */
+            data_type reduce_replacing(const ul level, const ul index, const data_type &replacement) const {
+                const data_type *values = tree[offsets[level] + index / fanout].values;
+
+                alignas(detail::cache_line) data_type buffer[fanout];
+                std::copy(values, values + fanout, buffer);
+                buffer[index % fanout] = replacement;
+
+                if constexpr (monoids::is_commutative<monoid>::value && std::is_arithmetic<data_type>::value) {
+                    fold_halves<fanout / 2>(buffer);
+
+                    return buffer[0];
+                } else {
+                    data_type result = monoid::identity();
+                    for (ul i = 0; i < fanout; ++i) {
+                        result = combine(result, buffer[i]);
+                    }
+
+                    return result;
+                }
+            }
+
+            /**
+             * Combines the element i with the element i + width of a buffer, halving the width
+             * down to a single element. The widths are known at compile time, so every step
+             * is a fixed size element-wise combine.
+             */
+            template<ul width>
+            void fold_halves(data_type *buffer) const {
+                for (ul i = 0; i < width; ++i) {
+                    buffer[i] = combine(buffer[i], buffer[i + width]);
+                }
+
+                if constexpr (width > 1) {
+                    fold_halves<width / 2>(buffer);
+                }
+            }
+
+            void is_in_leaf_bounds(const ul leaf_index) const {
+                if (leaf_index >= size) {
+                    throw std::out_of_range("Provided index is out of range.");
+                }
+            }
+
+            ul size;
+            std::vector<block> tree; // all of the levels, the leafs first and the root block last
+            std::vector<ul> offsets; // an index of the first block of every level
+            monoid combine;
+        };
+    }
+}
+
+#endif //SRC_WIDE_SEGMENT_TREE_H
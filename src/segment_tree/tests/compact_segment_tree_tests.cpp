@@ -0,0 +1,63 @@
+#define BOOST_TEST_MODULE compact_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <string>
+#include <random>
+#include "../src/compact_segment_tree.h"
+
+namespace {
+    struct concat {
+        static std::string identity() {
+            return "";
+        }
+
+        std::string operator()(const std::string &lhs, const std::string &rhs) const {
+            return lhs + rhs;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(non_power_of_two_non_commutative) {
+        using concat_segment = algo_lib::tree::compact_segment_tree<std::string, concat>;
+        constexpr int SIZE = 11;
+
+        std::string naive = "abcdefghijk";
+        concat_segment concat_tree(SIZE);
+        for (int i = 0; i < SIZE; ++i) {
+            concat_tree.set_leaf((algo_lib::tree::ul) i, naive.substr(i, 1));
+        }
+
+        BOOST_CHECK_EQUAL(concat_tree.node_count(), 2 * SIZE);
+        BOOST_CHECK_EQUAL(concat_tree.get_root_value(), naive);
+
+        std::mt19937 gen(3);
+        for (int step = 0; step < 300; ++step) {
+            algo_lib::tree::ul s = gen() % SIZE, e = gen() % SIZE;
+            if (s > e) std::swap(s, e);
+
+            if (step % 3 == 0) {
+                naive[s] = (char) ('a' + gen() % 26);
+                concat_tree.set_leaf(s, naive.substr(s, 1));
+            }
+
+            BOOST_CHECK_EQUAL(concat_tree.iterative_query(s, e), naive.substr(s, e - s + 1));
+        }
+
+        BOOST_CHECK_THROW(concat_tree.iterative_query(0, SIZE), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(bulk_build) {
+        std::vector<int> values{5, 3, 8, 1, 9};
+        algo_lib::tree::compact_segment_tree<int, algo_lib::tree::monoids::min<int>> min_tree(values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(min_tree.get_root_value(), 1);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(0, 2), 3);
+        BOOST_CHECK_EQUAL(min_tree.get_leaf_value(4), 9);
+
+        min_tree.leaf_update(4, 0);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(3, 4), 0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
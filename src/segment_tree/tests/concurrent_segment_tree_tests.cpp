@@ -0,0 +1,65 @@
+#define BOOST_TEST_MODULE concurrent_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <thread>
+#include "../src/concurrent_segment_tree.h"
+
+namespace tree = algo_lib::tree;
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(single_thread) {
+        tree::concurrent_segment_tree<int, tree::monoids::min<int>> min_tree(10);
+
+        for (int i = 0; i < 10; ++i) {
+            min_tree.set_leaf((tree::ul) i, 20 - i);
+        }
+        min_tree.apply_batch({{3, 1}, {7, 40}});
+
+        BOOST_CHECK_EQUAL(min_tree.get_root_value(), 1);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(4, 9), 11);
+        BOOST_CHECK_EQUAL(min_tree.get_leaf_value(7), 13);
+        BOOST_CHECK_THROW(min_tree.iterative_query(2, 16), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(readers_see_whole_batches) {
+        constexpr tree::ul SIZE = 1000;
+        constexpr long long TOTAL = 1000000;
+        tree::concurrent_segment_tree<long long> sum_tree(SIZE);
+        sum_tree.leaf_update(0, TOTAL);
+
+        std::atomic<bool> done{false};
+        std::atomic<long long> violations{0};
+
+        // every batch moves some amount between two leafs, so the total never changes
+        std::thread writer([&] {
+            std::mt19937 gen(1);
+            for (int i = 0; i < 20000; ++i) {
+                const long long amount = (long long) (gen() % 100);
+                sum_tree.apply_batch({{gen() % SIZE, -amount}, {gen() % SIZE, amount}});
+            }
+            done = true;
+        });
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 3; ++r) {
+            readers.emplace_back([&] {
+                do {
+                    if (sum_tree.iterative_query(0, SIZE - 1) != TOTAL) {
+                        ++violations;
+                    }
+                } while (!done);
+            });
+        }
+
+        writer.join();
+        for (auto &reader : readers) {
+            reader.join();
+        }
+
+        BOOST_CHECK_EQUAL(violations.load(), 0);
+        BOOST_CHECK_EQUAL(sum_tree.iterative_query(0, SIZE - 1), TOTAL);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,80 @@
+#define BOOST_TEST_MODULE lazy_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include "../src/lazy_segment_tree.h"
+
+namespace tree = algo_lib::tree;
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(range_add_range_sum) {
+        constexpr int SIZE = 13;
+        tree::lazy_segment_tree<long long> sum_tree(SIZE);
+        std::vector<long long> naive(SIZE, 0);
+        std::mt19937 gen(7);
+
+        for (int step = 0; step < 500; ++step) {
+            tree::ul s = gen() % SIZE, e = gen() % SIZE;
+            if (s > e) std::swap(s, e);
+
+            if (step % 2) {
+                long long delta = (long long) (gen() % 100) - 50;
+                sum_tree.update_range(s, e, delta);
+                for (tree::ul i = s; i <= e; ++i) naive[i] += delta;
+            } else {
+                long long expected = 0;
+                for (tree::ul i = s; i <= e; ++i) expected += naive[i];
+                BOOST_CHECK_EQUAL(sum_tree.iterative_query(s, e), expected);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(range_assign_range_min) {
+        using min_monoid = tree::monoids::min<int>;
+        constexpr int SIZE = 9;
+        tree::lazy_segment_tree<int, min_monoid, tree::tags::assign<int, min_monoid>> min_tree(SIZE);
+
+        for (int i = 0; i < SIZE; ++i) {
+            min_tree.set_leaf((tree::ul) i, 10 + i);
+        }
+
+        min_tree.update_range(2, 5, 3);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(0, 1), 10);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(0, 8), 3);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(6, 8), 16);
+
+        min_tree.update_range(4, 8, 20);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(4, 8), 20);
+        BOOST_CHECK_EQUAL(min_tree.get_leaf_value(3), 3);
+
+        min_tree.set_leaf(6, 1);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(5, 8), 1);
+        BOOST_CHECK_THROW(min_tree.update_range(5, 16, 0), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(range_affine_range_sum) {
+        constexpr int SIZE = 8;
+        tree::lazy_segment_tree<long long, tree::monoids::plus<long long>, tree::tags::affine<long long>> sum_tree(SIZE);
+        std::vector<long long> naive(SIZE, 1);
+
+        for (int i = 0; i < SIZE; ++i) {
+            sum_tree.set_leaf((tree::ul) i, 1);
+        }
+
+        sum_tree.update_range(0, 5, {2, 1});
+        sum_tree.update_range(3, 7, {3, -2});
+        for (int i = 0; i <= 5; ++i) naive[i] = 2 * naive[i] + 1;
+        for (int i = 3; i <= 7; ++i) naive[i] = 3 * naive[i] - 2;
+
+        for (tree::ul s = 0; s < SIZE; ++s) {
+            for (tree::ul e = s; e < SIZE; ++e) {
+                BOOST_CHECK_EQUAL(sum_tree.iterative_query(s, e),
+                                  std::accumulate(naive.begin() + s, naive.begin() + e + 1, 0LL));
+            }
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
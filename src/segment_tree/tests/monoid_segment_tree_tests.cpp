@@ -0,0 +1,168 @@
+#define BOOST_TEST_MODULE monoid_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <string>
+#include <numeric>
+#include <random>
+#include "../src/segment_tree.h"
+#include "../src/monoid_segment_tree.h"
+
+namespace {
+    struct concat {
+        static std::string identity() {
+            return "";
+        }
+
+        std::string operator()(const std::string &lhs, const std::string &rhs) const {
+            return lhs + rhs;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(matches_std_function_tree) {
+        using std_segment = algo_lib::tree::segment_tree<int>;
+        using sum_segment = algo_lib::tree::monoid_segment_tree<int, algo_lib::tree::monoids::plus<int>>;
+        constexpr int SIZE = 10;
+
+        std_segment reference(SIZE, 0, [](const int &lhs, const int &rhs) { return lhs + rhs; });
+        sum_segment sum_tree(SIZE);
+
+        for (int i = 0; i < SIZE; ++i) {
+            reference.leaf_update((algo_lib::tree::ul) i, i * i + 2 * i - 5);
+            sum_tree.leaf_update((algo_lib::tree::ul) i, i * i + 2 * i - 5);
+        }
+
+        BOOST_CHECK_EQUAL(sum_tree.get_root_value(), 325);
+        for (algo_lib::tree::ul s = 0; s < SIZE; ++s) {
+            for (algo_lib::tree::ul e = s; e < SIZE; ++e) {
+                BOOST_CHECK_EQUAL(sum_tree.iterative_query(s, e), reference.iterative_query(s, e));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(min_and_non_commutative) {
+        using min_segment = algo_lib::tree::monoid_segment_tree<int, algo_lib::tree::monoids::min<int>>;
+        using concat_segment = algo_lib::tree::monoid_segment_tree<std::string, concat>;
+        constexpr int SIZE = 6;
+
+        min_segment min_tree(SIZE);
+        concat_segment concat_tree(SIZE);
+
+        for (int i = 0; i < SIZE; ++i) {
+            min_tree.set_leaf((algo_lib::tree::ul) i, (i * 5) % SIZE);
+            concat_tree.set_leaf((algo_lib::tree::ul) i, std::string(1, (char) ('a' + i)));
+        }
+
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(1, 4), 2);
+        BOOST_CHECK_EQUAL(min_tree.iterative_query(1, 2), 4);
+        BOOST_CHECK_EQUAL(concat_tree.iterative_query(1, 4), "bcde");
+        BOOST_CHECK_EQUAL(concat_tree.iterative_query(0, 5), "abcdef");
+        BOOST_CHECK_EQUAL(concat_tree.get_leaf_value(3), "d");
+        BOOST_CHECK_THROW(concat_tree.iterative_query(3, 2), std::out_of_range);
+        BOOST_CHECK_THROW(concat_tree.get_leaf_value(8), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(bulk_build) {
+        using sum_segment = algo_lib::tree::monoid_segment_tree<long long>;
+        constexpr int SIZE = 1000;
+
+        std::vector<long long> values(SIZE);
+        std::iota(values.begin(), values.end(), 1);
+
+        sum_segment built(values.begin(), values.end(), {}, 4);
+        BOOST_CHECK_EQUAL(built.get_root_value(), SIZE * (SIZE + 1) / 2);
+        BOOST_CHECK_EQUAL(built.iterative_query(10, 19), 155);
+
+        built.build(values.begin(), values.begin() + 10);
+        BOOST_CHECK_EQUAL(built.get_root_value(), 55);
+    }
+
+    BOOST_AUTO_TEST_CASE(prefix_descent_non_commutative) {
+        using concat_segment = algo_lib::tree::monoid_segment_tree<std::string, concat>;
+        using algo_lib::tree::ul;
+        constexpr int SIZE = 13;
+        const std::string naive = "abcdefghijklm";
+
+        std::vector<std::string> leafs;
+        for (char c : naive) {
+            leafs.emplace_back(1, c);
+        }
+        concat_segment concat_tree(leafs.begin(), leafs.end());
+
+        // holds as long as the accumulated string does not contain 'h'
+        auto without_h = [](const std::string &acc) { return acc.find('h') == std::string::npos; };
+
+        for (ul s = 0; s <= SIZE; ++s) {
+            BOOST_CHECK_EQUAL(concat_tree.max_right(s, without_h), s <= 7 ? 7 : SIZE);
+        }
+        for (ul e = 0; e <= SIZE; ++e) {
+            BOOST_CHECK_EQUAL(concat_tree.min_left(e, without_h), e <= 7 ? 0 : 8);
+        }
+
+        auto short_enough = [](const std::string &acc) { return acc.size() <= 3; };
+        BOOST_CHECK_EQUAL(concat_tree.max_right(2, short_enough), 5);
+        BOOST_CHECK_EQUAL(concat_tree.min_left(10, short_enough), 7);
+        BOOST_CHECK_THROW(concat_tree.max_right(SIZE + 1, without_h), std::out_of_range);
+        BOOST_CHECK_THROW(concat_tree.min_left(SIZE + 1, without_h), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(batched_updates) {
+        using sum_segment = algo_lib::tree::monoid_segment_tree<long long>;
+        using algo_lib::tree::ul;
+        constexpr ul SIZE = 1000;
+
+        std::mt19937 gen(4);
+        std::vector<std::pair<ul, long long>> updates;
+        for (int i = 0; i < 5000; ++i) {
+            updates.emplace_back(gen() % SIZE, (long long) (gen() % 100));
+        }
+
+        sum_segment reference(SIZE);
+        for (const auto &update : updates) {
+            reference.leaf_update(update.first, update.second);
+        }
+
+        for (unsigned threads : {1u, 4u}) {
+            sum_segment batched(SIZE);
+            batched.apply_batch(updates, threads);
+            batched.apply_batch({});
+
+            BOOST_CHECK_EQUAL(batched.get_root_value(), reference.get_root_value());
+            for (ul s = 0; s < SIZE; s += 37) {
+                BOOST_CHECK_EQUAL(batched.iterative_query(s, SIZE - 1), reference.iterative_query(s, SIZE - 1));
+            }
+        }
+
+        sum_segment untouched(SIZE);
+        BOOST_CHECK_THROW(untouched.apply_batch({{1, 1}, {SIZE + 100, 1}}), std::out_of_range);
+        BOOST_CHECK_EQUAL(untouched.get_root_value(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(small_batch_on_large_tree) {
+        using sum_segment = algo_lib::tree::monoid_segment_tree<long long>;
+        using algo_lib::tree::ul;
+        constexpr ul SIZE = 5000;
+
+        // few updates compared to the size of a tree, including repeated and neighbouring leafs
+        const std::vector<std::pair<ul, long long>> updates{{4999, 3}, {0, 1}, {17, 5}, {16, 2}, {4999, 4}, {2500, 7}};
+
+        sum_segment reference(SIZE);
+        for (const auto &update : updates) {
+            reference.leaf_update(update.first, update.second);
+        }
+
+        for (unsigned threads : {1u, 3u}) {
+            sum_segment batched(SIZE);
+            batched.apply_batch(updates, threads);
+
+            BOOST_CHECK_EQUAL(batched.get_root_value(), 22);
+            for (ul s = 0; s < SIZE; s += 101) {
+                BOOST_CHECK_EQUAL(batched.iterative_query(s, SIZE - 1), reference.iterative_query(s, SIZE - 1));
+            }
+            BOOST_CHECK_EQUAL(batched.iterative_query(16, 17), 7);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
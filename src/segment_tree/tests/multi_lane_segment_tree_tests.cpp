@@ -0,0 +1,67 @@
+#define BOOST_TEST_MODULE multi_lane_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <string>
+#include <random>
+#include "../src/monoid_segment_tree.h"
+#include "../src/multi_lane_segment_tree.h"
+
+namespace tree = algo_lib::tree;
+
+namespace {
+    struct concat {
+        static std::string identity() {
+            return "";
+        }
+
+        std::string operator()(const std::string &lhs, const std::string &rhs) const {
+            return lhs + rhs;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(lanes_match_separate_trees) {
+        constexpr tree::ul SIZE = 21, LANES = 5;
+        tree::multi_lane_segment_tree<long long> lanes(SIZE, LANES);
+        std::vector<tree::monoid_segment_tree<long long>> separate(LANES, tree::monoid_segment_tree<long long>(SIZE));
+        std::mt19937 gen(1);
+
+        for (int step = 0; step < 300; ++step) {
+            const tree::ul index = gen() % SIZE;
+            std::vector<long long> updaters(LANES);
+            for (tree::ul lane = 0; lane < LANES; ++lane) {
+                updaters[lane] = (long long) (gen() % 100) - 50;
+                separate[lane].leaf_update(index, updaters[lane]);
+            }
+            lanes.leaf_update(index, updaters.data());
+
+            tree::ul s = gen() % SIZE, e = gen() % SIZE;
+            if (s > e) std::swap(s, e);
+
+            const auto result = lanes.iterative_query(s, e);
+            for (tree::ul lane = 0; lane < LANES; ++lane) {
+                BOOST_CHECK_EQUAL(result[lane], separate[lane].iterative_query(s, e));
+                BOOST_CHECK_EQUAL(lanes.get_leaf_value(index, lane), separate[lane].get_leaf_value(index));
+            }
+        }
+
+        BOOST_CHECK_EQUAL(lanes.get_root_value(2), separate[2].get_root_value());
+        BOOST_CHECK_THROW(lanes.get_root_value(LANES), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(non_commutative_lanes) {
+        tree::multi_lane_segment_tree<std::string, concat> lanes(6, 2);
+
+        for (tree::ul i = 0; i < 6; ++i) {
+            const std::string values[] = {std::string(1, (char) ('a' + i)), std::string(1, (char) ('A' + i))};
+            lanes.set_leaf(i, values);
+        }
+
+        const auto result = lanes.iterative_query(1, 4);
+        BOOST_CHECK_EQUAL(result[0], "bcde");
+        BOOST_CHECK_EQUAL(result[1], "BCDE");
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,60 @@
+#define BOOST_TEST_MODULE persistent_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <numeric>
+#include "../src/persistent_segment_tree.h"
+
+namespace tree = algo_lib::tree;
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(versions_are_independent) {
+        using sum_tree = tree::persistent_segment_tree<long long>;
+        constexpr int SIZE = 23;
+        constexpr int VERSIONS = 200;
+
+        sum_tree t(SIZE);
+        std::vector<sum_tree::version> versions{t.initial()};
+        std::vector<std::vector<long long>> naive{std::vector<long long>(SIZE, 0)};
+        std::mt19937 gen(5);
+
+        for (int v = 1; v < VERSIONS; ++v) {
+            const auto base = gen() % versions.size();
+            const tree::ul index = gen() % SIZE;
+            const long long delta = (long long) (gen() % 100) - 50;
+
+            versions.push_back(t.leaf_update(versions[base], index, delta));
+            naive.push_back(naive[base]);
+            naive.back()[index] += delta;
+        }
+
+        for (int v = 0; v < VERSIONS; ++v) {
+            tree::ul s = gen() % SIZE, e = gen() % SIZE;
+            if (s > e) std::swap(s, e);
+
+            BOOST_CHECK_EQUAL(t.iterative_query(versions[v], s, e),
+                              std::accumulate(naive[v].begin() + s, naive[v].begin() + e + 1, 0LL));
+            BOOST_CHECK_EQUAL(t.get_root_value(versions[v]), std::accumulate(naive[v].begin(), naive[v].end(), 0LL));
+        }
+
+        // the height of a tree over 23 leafs is 5, so every version takes at most 6 new nodes
+        BOOST_CHECK_LE(t.node_count(), 1 + (VERSIONS - 1) * 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(build_and_set) {
+        tree::persistent_segment_tree<int, tree::monoids::max<int>> t(6);
+        std::vector<int> values{4, 8, 1, 7};
+
+        const auto built = t.build(values.begin(), values.end());
+        const auto changed = t.set_leaf(built, 1, 0);
+
+        BOOST_CHECK_EQUAL(t.get_root_value(built), 8);
+        BOOST_CHECK_EQUAL(t.get_root_value(changed), 7);
+        BOOST_CHECK_EQUAL(t.iterative_query(built, 0, 2), 8);
+        BOOST_CHECK_EQUAL(t.iterative_query(changed, 0, 2), 4);
+        BOOST_CHECK_EQUAL(t.get_leaf_value(changed, 3), 7);
+        BOOST_CHECK_THROW(t.get_leaf_value(changed, 6), std::out_of_range);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -21,4 +21,98 @@ BOOST_AUTO_TEST_SUITE(simple);
         BOOST_CHECK_EQUAL(sum_tree.get_root_value(), 325);
     }
 
+    BOOST_AUTO_TEST_CASE(bulk_build) {
+        using std_segment = algo_lib::tree::segment_tree<int>;
+        constexpr int SIZE = 37;
+        auto adder = [](const int& lhs, const int& rhs) { return lhs + rhs; };
+
+        std::vector<int> values(SIZE);
+        for (int i = 0; i < SIZE; ++i) {
+            values[i] = i * i + 2 * i - 5;
+        }
+
+        std_segment reference(SIZE, 0, adder);
+        for (int i = 0; i < SIZE; ++i) {
+            reference.leaf_update((algo_lib::tree::ul) i, values[i]);
+        }
+
+        for (unsigned threads : {1u, 3u, 8u, 128u}) {
+            std_segment built(values.begin(), values.end(), 0, adder, threads);
+
+            BOOST_CHECK_EQUAL(built.get_root_value(), reference.get_root_value());
+            BOOST_CHECK_EQUAL(built.get_leaf_value(7), values[7]);
+            BOOST_CHECK_EQUAL(built.iterative_query(3, 29), reference.iterative_query(3, 29));
+        }
+
+        std_segment small(4, 0, adder);
+        BOOST_CHECK_THROW(small.build(values.begin(), values.end()), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(prefix_descent) {
+        using std_segment = algo_lib::tree::segment_tree<int>;
+        using algo_lib::tree::ul;
+        constexpr int SIZE = 16;
+        std::vector<int> values{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3};
+
+        std_segment sum_tree(values.begin(), values.end(), 0, [](const int& lhs, const int& rhs) { return lhs + rhs; });
+
+        for (int limit : {0, 3, 4, 10, 50, 1000}) {
+            auto fits = [limit](const int sum) { return sum <= limit; };
+
+            for (ul s = 0; s <= SIZE; ++s) {
+                ul expected = s;
+                for (int sum = 0; expected < SIZE && fits(sum + values[expected]); ++expected) {
+                    sum += values[expected];
+                }
+                BOOST_CHECK_EQUAL(sum_tree.max_right(s, fits), expected);
+            }
+
+            for (ul e = 0; e <= SIZE; ++e) {
+                ul expected = e;
+                for (int sum = 0; expected > 0 && fits(sum + values[expected - 1]); --expected) {
+                    sum += values[expected - 1];
+                }
+                BOOST_CHECK_EQUAL(sum_tree.min_left(e, fits), expected);
+            }
+        }
+
+        BOOST_CHECK_THROW(sum_tree.max_right(SIZE + 1, [](const int) { return true; }), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(prefix_descent_not_power_of_two) {
+        using std_segment = algo_lib::tree::segment_tree<int>;
+        using algo_lib::tree::ul;
+        constexpr ul SIZE = 10; // 16 leafs, the last 6 of them are padding
+        std::vector<int> values{3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+
+        std_segment sum_tree(values.begin(), values.end(), 0, [](const int& lhs, const int& rhs) { return lhs + rhs; });
+        auto always = [](const int) { return true; };
+        auto fits = [](const int sum) { return sum <= 8; };
+
+        BOOST_CHECK_EQUAL(sum_tree.max_right(0, always), SIZE);
+        BOOST_CHECK_EQUAL(sum_tree.max_right(7, always), SIZE);
+        BOOST_CHECK_EQUAL(sum_tree.max_right(SIZE, always), SIZE);
+        BOOST_CHECK_EQUAL(sum_tree.max_right(8, fits), SIZE);
+        BOOST_CHECK_EQUAL(sum_tree.max_right(0, fits), 3);
+        BOOST_CHECK_EQUAL(sum_tree.min_left(SIZE, always), 0);
+        BOOST_CHECK_EQUAL(sum_tree.min_left(SIZE, fits), 8);
+
+        BOOST_CHECK_THROW(sum_tree.max_right(SIZE + 1, always), std::out_of_range);
+        BOOST_CHECK_THROW(sum_tree.min_left(SIZE + 1, always), std::out_of_range);
+        BOOST_CHECK_THROW(sum_tree.min_left(16, always), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(batched_updates) {
+        using std_segment = algo_lib::tree::segment_tree<int>;
+        auto adder = [](const int& lhs, const int& rhs) { return lhs + rhs; };
+
+        std_segment sum_tree(10, 0, adder);
+        sum_tree.apply_batch({{0, 5}, {9, 2}, {0, 1}, {4, 7}}, 2);
+        sum_tree.apply_batch({{4, 100}}, [](const int&, const int& value) { return value; });
+
+        BOOST_CHECK_EQUAL(sum_tree.get_root_value(), 108);
+        BOOST_CHECK_EQUAL(sum_tree.iterative_query(0, 3), 6);
+        BOOST_CHECK_EQUAL(sum_tree.get_leaf_value(4), 100);
+    }
+
 BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,60 @@
+#define BOOST_TEST_MODULE sparse_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <map>
+#include <random>
+#include "../src/sparse_segment_tree.h"
+
+namespace tree = algo_lib::tree;
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(full_64_bit_range) {
+        tree::sparse_segment_tree<long long> sum_tree;
+        std::map<std::uint64_t, long long> naive;
+        std::mt19937_64 gen(9);
+        constexpr int UPDATES = 300;
+
+        std::vector<std::uint64_t> keys{0, std::numeric_limits<std::uint64_t>::max()};
+        for (int i = 0; i < UPDATES; ++i) {
+            keys.push_back(gen());
+        }
+
+        for (const auto key : keys) {
+            const long long delta = (long long) (gen() % 100);
+            sum_tree.leaf_update(key, delta);
+            naive[key] += delta;
+        }
+
+        for (int i = 0; i < 200; ++i) {
+            std::uint64_t s = keys[gen() % keys.size()], e = gen();
+            if (s > e) std::swap(s, e);
+
+            long long expected = 0;
+            for (auto it = naive.lower_bound(s); it != naive.end() && it->first <= e; ++it) {
+                expected += it->second;
+            }
+            BOOST_CHECK_EQUAL(sum_tree.iterative_query(s, e), expected);
+        }
+
+        BOOST_CHECK_EQUAL(sum_tree.get_leaf_value(0), naive[0]);
+        BOOST_CHECK_EQUAL(sum_tree.get_leaf_value(1), 0);
+        // every update creates at most 64 nodes besides the root
+        BOOST_CHECK_LE(sum_tree.node_count(), 2 + keys.size() * 64);
+    }
+
+    BOOST_AUTO_TEST_CASE(bounded_range) {
+        tree::sparse_segment_tree<int, tree::monoids::max<int>> max_tree(1000, 2000);
+
+        max_tree.set_leaf(1500, 7);
+        max_tree.set_leaf(1200, 3);
+        max_tree.set_leaf(1500, 2);
+
+        BOOST_CHECK_EQUAL(max_tree.get_root_value(), 3);
+        BOOST_CHECK_EQUAL(max_tree.iterative_query(1300, 2000), 2);
+        BOOST_CHECK_EQUAL(max_tree.iterative_query(1000, 1100), std::numeric_limits<int>::lowest());
+        BOOST_CHECK_THROW(max_tree.set_leaf(999, 1), std::out_of_range);
+        BOOST_CHECK_THROW(max_tree.iterative_query(1000, 2001), std::out_of_range);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
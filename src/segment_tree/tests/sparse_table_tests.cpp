@@ -0,0 +1,53 @@
+#define BOOST_TEST_MODULE sparse_table
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include "../src/sparse_table.h"
+
+namespace tree = algo_lib::tree;
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(min_max_gcd_against_naive) {
+        constexpr int SIZE = 77;
+        std::mt19937 gen(8);
+        std::vector<long long> values(SIZE);
+        for (auto &v : values) {
+            v = (long long) (gen() % 60) * 6;
+        }
+
+        tree::sparse_table<long long> min_table(values.begin(), values.end());
+        tree::sparse_table<long long, tree::monoids::max<long long>> max_table(values.begin(), values.end());
+        tree::sparse_table<long long, tree::monoids::gcd<long long>> gcd_table(values.begin(), values.end());
+
+        for (tree::ul s = 0; s < SIZE; ++s) {
+            for (tree::ul e = s; e < SIZE; ++e) {
+                BOOST_CHECK_EQUAL(min_table.iterative_query(s, e),
+                                  *std::min_element(values.begin() + s, values.begin() + e + 1));
+                BOOST_CHECK_EQUAL(max_table.iterative_query(s, e),
+                                  *std::max_element(values.begin() + s, values.begin() + e + 1));
+
+                long long expected_gcd = 0;
+                for (tree::ul i = s; i <= e; ++i) {
+                    expected_gcd = std::gcd(expected_gcd, values[i]);
+                }
+                BOOST_CHECK_EQUAL(gcd_table.iterative_query(s, e), expected_gcd);
+            }
+        }
+
+        BOOST_CHECK_EQUAL(min_table.get_leaf_value(5), values[5]);
+        BOOST_CHECK_EQUAL(max_table.get_root_value(), *std::max_element(values.begin(), values.end()));
+        BOOST_CHECK_THROW(min_table.iterative_query(3, SIZE), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(single_element) {
+        std::vector<int> values{42};
+        tree::sparse_table<int, tree::monoids::max<int>> table(values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(table.get_root_value(), 42);
+        BOOST_CHECK_EQUAL(table.iterative_query(0, 0), 42);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,76 @@
+#define BOOST_TEST_MODULE wide_segment_tree
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <string>
+#include <random>
+#include <numeric>
+#include "../src/wide_segment_tree.h"
+
+namespace tree = algo_lib::tree;
+
+namespace {
+    struct concat {
+        static std::string identity() {
+            return "";
+        }
+
+        std::string operator()(const std::string &lhs, const std::string &rhs) const {
+            return lhs + rhs;
+        }
+    };
+
+    template<typename Tree, typename Fn>
+    void check_against_naive(Tree &t, std::vector<long long> &naive, Fn fold) {
+        std::mt19937 gen(11);
+        for (int step = 0; step < 2000; ++step) {
+            tree::ul s = gen() % naive.size(), e = gen() % naive.size();
+            if (s > e) std::swap(s, e);
+
+            if (step % 2) {
+                naive[s] = (long long) (gen() % 1000) - 500;
+                t.set_leaf(s, naive[s]);
+            } else {
+                BOOST_CHECK_EQUAL(t.iterative_query(s, e), fold(naive.begin() + s, naive.begin() + e + 1));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(sum_and_min_against_naive) {
+        constexpr int SIZE = 1000;
+        std::vector<long long> naive(SIZE);
+        std::iota(naive.begin(), naive.end(), -300);
+
+        tree::wide_segment_tree<long long> sum_tree(naive.begin(), naive.end());
+        BOOST_CHECK_EQUAL(sum_tree.height(), 4);
+        BOOST_CHECK_EQUAL(sum_tree.get_root_value(), std::accumulate(naive.begin(), naive.end(), 0LL));
+        check_against_naive(sum_tree, naive, [](auto b, auto e) { return std::accumulate(b, e, 0LL); });
+
+        tree::wide_segment_tree<long long, tree::monoids::min<long long>, 4> min_tree(naive.begin(), naive.end());
+        BOOST_CHECK_EQUAL(min_tree.get_leaf_value(3), naive[3]);
+        check_against_naive(min_tree, naive, [](auto b, auto e) { return *std::min_element(b, e); });
+    }
+
+    BOOST_AUTO_TEST_CASE(non_commutative) {
+        constexpr int SIZE = 37;
+        std::string naive;
+        tree::wide_segment_tree<std::string, concat, 4> concat_tree(SIZE);
+
+        for (int i = 0; i < SIZE; ++i) {
+            naive.push_back((char) ('a' + i % 26));
+            concat_tree.set_leaf((tree::ul) i, naive.substr(i, 1));
+        }
+
+        BOOST_CHECK_EQUAL(concat_tree.get_root_value(), naive);
+        for (tree::ul s = 0; s < SIZE; ++s) {
+            for (tree::ul e = s; e < SIZE; ++e) {
+                BOOST_CHECK_EQUAL(concat_tree.iterative_query(s, e), naive.substr(s, e - s + 1));
+            }
+        }
+
+        BOOST_CHECK_THROW(concat_tree.get_leaf_value(SIZE), std::out_of_range);
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -1,4 +1,5 @@
-#include "../src/segment_tree.h"
+#include "../src/multi_lane_segment_tree.h"
+#include <iostream>
 
 /*
  * Represents a typical segment tree usage.
@@ -7,24 +8,34 @@
  * K-inversion is a set of indexes i(1) to i(k) that satisfies both:
  *  - 1 <= i(1) < i(2) < ... < i(k) <= n
  *  - a[i(1)] > a[i(2)] > ... > a[i(k)]
+ *
+ * The lane j of a tree holds (at the leaf v - 1) the number of (j + 1)-inversions ending
+ * with the value v, so all of the k layers are updated and queried in a single traversal.
  */
 
 constexpr long long MOD = 1000000000;
 
+struct modulo_adder {
+    static constexpr bool commutative = true;
+
+    static constexpr unsigned long identity() noexcept {
+        return 0;
+    }
+
+    unsigned long operator()(const unsigned long &lhs, const unsigned long &rhs) const {
+        return (lhs + rhs) % MOD;
+    }
+};
+
 void k_inversions() {
-    using Tree = algo_lib::tree::segment_tree<unsigned long>;
+    using Tree = algo_lib::tree::multi_lane_segment_tree<unsigned long, modulo_adder>;
 
     unsigned long n, k;
     std::cin >> n >> k;
 
     std::vector<unsigned long> vi;
-    std::vector<Tree> trees;
-    auto modulo_adder = [&] (const unsigned long& lhs, const unsigned long& rhs) { return (lhs + rhs) % MOD; };
-    auto without_leaf_update = [] (const unsigned long& acc, const unsigned long& updater) { return updater; };
-
-    for (unsigned long i = 0; i < k; ++i) {
-        trees.emplace_back(n, 0, modulo_adder);
-    }
+    Tree tree(n, k);
+    std::vector<unsigned long> greater(k), leaf(k);
 
     for (unsigned long i = 0; i < n; ++i) {
         unsigned long aux;
@@ -34,22 +45,21 @@ void k_inversions() {
     }
 
     for (unsigned long x = 0; x < n; ++x) {
-        for (long long j = (long) k - 1; j >= 0; j--) {
-            if (j == 0) {
-                trees[j].update_leaf(vi[x] - 1, 1, without_leaf_update);
-                continue;
-            }
-
-            unsigned long adder = 0;
-            try {
-                adder = trees[j - 1].iterative_query(vi[x], n - 1);
-            } catch (...) {}
-
-            trees[j].update_leaf(vi[x] - 1, adder, without_leaf_update);
+        std::fill(greater.begin(), greater.end(), 0);
+        if (vi[x] < n) {
+            tree.iterative_query(vi[x], n - 1, greater.data());
         }
+
+        // a (j + 1)-inversion ending at x extends any j-inversion ending with a greater value
+        leaf[0] = 1;
+        for (unsigned long j = 1; j < k; ++j) {
+            leaf[j] = greater[j - 1];
+        }
+
+        tree.set_leaf(vi[x] - 1, leaf.data());
     }
 
-    std::cout << (trees[k - 1].iterative_query(0, n - 1) % MOD) << std::endl;
+    std::cout << (tree.iterative_query(0, n - 1)[k - 1] % MOD) << std::endl;
 }
 
 int main() {
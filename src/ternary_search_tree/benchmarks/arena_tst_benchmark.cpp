@@ -0,0 +1,71 @@
+#include <chrono>
+#include <memory>
+#include <random>
+#include <iostream>
+#include <malloc.h>
+#include "../src/ternary_search_tree.h"
+#include "../src/arena_tst.h"
+
+/*
+ * Memory taken by a dictionary of 10^6 random words and the lookup time, the persistent TST
+ * against the arena_tst. The heap usage is read with glibc's mallinfo2, so it includes
+ * the allocator's per-allocation overhead.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 arena_tst_benchmark.cpp
+ */
+
+constexpr int WORDS = 1000000;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::size_t heap_in_use() {
+    return mallinfo2().uordblks;
+}
+
+int main() {
+    std::mt19937 gen(42);
+    std::vector<std::string> words(WORDS);
+    for (auto &word : words) {
+        word.resize(4 + gen() % 12);
+        for (auto &c : word) c = (char) ('a' + gen() % 26);
+    }
+
+    std::size_t found_persistent = 0, found_arena = 0, persistent_nodes = 0, arena_nodes = 0;
+    std::size_t persistent_bytes = 0, arena_bytes = 0;
+    double persistent_build = 0, arena_build = 0, persistent_lookup = 0, arena_lookup = 0;
+    {
+        const std::size_t before = heap_in_use();
+        std::unique_ptr<algo_lib::tree::TST<char>> tree(new algo_lib::tree::TST<char>());
+        persistent_build = measure([&] {
+            for (const auto &word : words) tree.reset(new algo_lib::tree::TST<char>(*tree + word));
+        });
+        persistent_bytes = heap_in_use() - before;
+        persistent_lookup = measure([&] {
+            for (const auto &word : words) found_persistent += tree->exist(word);
+        });
+        persistent_nodes = tree->size();
+    }
+    {
+        const std::size_t before = heap_in_use();
+        algo_lib::tree::arena_tst<char> tree;
+        arena_build = measure([&] {
+            for (const auto &word : words) tree.insert(word);
+        });
+        arena_bytes = heap_in_use() - before;
+        arena_lookup = measure([&] {
+            for (const auto &word : words) found_arena += tree.exist(word);
+        });
+        arena_nodes = tree.size();
+    }
+
+    std::cout << WORDS << " words, " << persistent_nodes << " nodes" << (arena_nodes == persistent_nodes ? "" : " (MISMATCH)") << std::endl
+              << "TST: " << persistent_bytes / (1 << 20) << " MB (" << persistent_bytes / persistent_nodes << " B/node), build "
+              << persistent_build << " ms, lookups " << persistent_lookup << " ms" << std::endl
+              << "arena_tst: " << arena_bytes / (1 << 20) << " MB (" << arena_bytes / arena_nodes << " B/node), build "
+              << arena_build << " ms, lookups " << arena_lookup << " ms"
+              << (found_arena == found_persistent ? "" : " (MISMATCH)") << std::endl;
+}
@@ -0,0 +1,62 @@
+#include <chrono>
+#include <memory>
+#include <random>
+#include <iostream>
+#include "../src/ternary_search_tree.h"
+
+/*
+ * Per-lookup latency of TST::exist and TST::prefix (which walk the raw node pointers) against
+ * the former recursive lookup, which built a temporary TST (copying a std::shared_ptr) at every step.
+ * Compile with optimisations, f.e.: g++ -std=c++17 -O2 tst_lookup_benchmark.cpp
+ */
+
+using TST = algo_lib::tree::TST<char>;
+
+bool recursive_exist(const TST &tree, const char *str) {
+    return str[0] == '\0' || tree.empty() ? false
+                                          : str[0] == tree.value() ? (str[1] == '\0' ? tree.word() : recursive_exist(tree.center(), str + 1))
+                                                                   : recursive_exist(str[0] > tree.value() ? tree.right() : tree.left(), str);
+}
+
+template<typename Fn>
+double nanoseconds_per_call(const std::size_t calls, Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (double) calls;
+}
+
+int main() {
+    std::mt19937 gen(42);
+
+    for (int count : {1000, 100000, 1000000}) {
+        std::vector<std::string> words(count);
+        for (auto &word : words) {
+            word.resize(4 + gen() % 12);
+            for (auto &c : word) c = (char) ('a' + gen() % 26);
+        }
+
+        std::unique_ptr<TST> tree(new TST());
+        for (const auto &word : words) tree.reset(new TST(*tree + word));
+
+        std::vector<std::string> queries(1000000);
+        for (auto &query : queries) {
+            query = words[gen() % words.size()];
+            if (gen() % 2) query.back() = 'A'; // a miss at the last step
+        }
+
+        std::size_t recursive_found = 0, found = 0, common = 0;
+        const double recursive_ns = nanoseconds_per_call(queries.size(), [&] {
+            for (const auto &query : queries) recursive_found += recursive_exist(*tree, query.c_str());
+        });
+        const double iterative_ns = nanoseconds_per_call(queries.size(), [&] {
+            for (const auto &query : queries) found += tree->exist(query);
+        });
+        const double prefix_ns = nanoseconds_per_call(queries.size(), [&] {
+            for (const auto &query : queries) common += tree->prefix(query).size();
+        });
+
+        std::cout << count << " words, recursive exist: " << recursive_ns << " ns, exist: " << iterative_ns
+                  << " ns, prefix: " << prefix_ns << " ns (" << common << " common elements)"
+                  << (found == recursive_found ? "" : " (MISMATCH)") << std::endl;
+    }
+}
@@ -0,0 +1,206 @@
+#ifndef SRC_ARENA_TST_H
+#define SRC_ARENA_TST_H
+
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+
+namespace algo_lib {
+    namespace tree {
+        /**
+         * @brief Mutable Ternary Search Tree with all of the nodes kept in a single arena.
+         * @tparam C Type of elements stored in a tree. It is essential for that type to have comparators implemented.
+         *
+         * Unlike TST it is not persistent: insert changes the tree in place. Children are linked
+         * by 32 bit indexes into a std::vector of nodes, there are no separate allocations and no
+         * reference counting, so a node takes 3 * 4 bytes + sizeof(C) + 1 (16 bytes for char)
+         * instead of three std::shared_ptr objects and a control block of a std::make_shared allocation.
+         * The root is the node 0, which can never be a child, so 0 also stands for 'no child'.
+         * All of the operations are iterative.
+         */
+        template<typename C = char>
+        class arena_tst {
+        private:
+            using index = std::uint32_t;
+            static constexpr index none = 0;
+
+            struct Node {
+                index left_tst = none;
+                index middle_tst = none;
+                index right_tst = none;
+                C data;
+                bool is_end = false; ///< indicated the end of a sequence
+
+                explicit Node(const C &v)
+                        : data(v) {}
+            };
+
+            std::vector<Node> nodes;
+
+            /**
+             * Appends a new node to the arena.
+             * @return Its index.
+             */
+            index make_node(const C &value) {
+                if (nodes.size() >= (std::size_t) std::numeric_limits<index>::max()) {
+                    throw std::length_error("Size of a tree is out of the supported range.");
+                }
+
+                nodes.emplace_back(value);
+                return (index) (nodes.size() - 1);
+            }
+
+        public:
+            arena_tst() = default;
+
+            /**
+             * @brief Builds a tree from a range of sequences.
+             */
+            template<typename InputIterator>
+            arena_tst(InputIterator first, InputIterator last) {
+                for (; first != last; ++first) {
+                    insert(*first);
+                }
+            }
+
+            /**
+             * @brief Reserves the space for @count nodes, so the arena is not reallocated while it grows.
+             */
+            void reserve(const std::size_t count) {
+                nodes.reserve(count);
+            }
+
+            bool insert(const std::basic_string<C> &str) {
+                return insert(str.c_str());
+            }
+
+            /**
+             * @brief Adds a sequence of elements to a tree.
+             * @param str Sequence of elements to add, must end with '\0'
+             * @return True if the sequence was not present in a tree before, false otherwise.
+             */
+            bool insert(const C *str) {
+                if (str[0] == '\0') {
+                    return false;
+                }
+
+                if (nodes.empty()) {
+                    make_node(str[0]);
+                }
+
+                index current = 0;
+                while (true) {
+                    const Node &node = nodes[current];
+                    index Node::*child;
+
+                    if (str[0] < node.data) {
+                        child = &Node::left_tst;
+                    } else if (str[0] > node.data) {
+                        child = &Node::right_tst;
+                    } else if (str[1] == '\0') {
+                        const bool added = !node.is_end;
+                        nodes[current].is_end = true;
+                        return added;
+                    } else {
+                        ++str;
+                        child = &Node::middle_tst;
+                    }
+
+                    // make_node may reallocate the arena, so the nodes are accessed by indexes only
+                    if (nodes[current].*child == none) {
+                        const index created = make_node(str[0]);
+                        nodes[current].*child = created;
+                    }
+                    current = nodes[current].*child;
+                }
+            }
+
+            /**
+             * @brief Checks whether a given sequence is present in a tree.
+             * @param str Sequence of elements, must end with '\0'
+             * @return One boolean, true if the given sequence is present, false otherwise.
+             */
+            bool exist(const C *str) const {
+                if (str[0] == '\0' || nodes.empty()) {
+                    return false;
+                }
+
+                index current = 0;
+                while (true) {
+                    const Node &node = nodes[current];
+
+                    if (str[0] < node.data) {
+                        current = node.left_tst;
+                    } else if (str[0] > node.data) {
+                        current = node.right_tst;
+                    } else if (str[1] == '\0') {
+                        return node.is_end;
+                    } else {
+                        ++str;
+                        current = node.middle_tst;
+                    }
+
+                    if (current == none) {
+                        return false;
+                    }
+                }
+            }
+
+            bool exist(const std::basic_string<C> &str) const {
+                return exist(str.c_str());
+            }
+
+            /**
+             * @brief Searches for the longest common prefix of a given sequence and every sequence in a tree.
+             * @param str Sequence of elements
+             * @return The longest common prefix of a given sequence and every sequence in a tree,
+             * the same as TST::prefix
+             */
+            std::basic_string<C> prefix(const std::basic_string<C> &str) const {
+                std::size_t common = 0;
+                index current = 0;
+
+                while (!nodes.empty() && common < str.size()) {
+                    const Node &node = nodes[current];
+
+                    if (str[common] < node.data) {
+                        current = node.left_tst;
+                    } else if (str[common] > node.data) {
+                        current = node.right_tst;
+                    } else {
+                        ++common;
+                        current = node.middle_tst;
+                    }
+
+                    if (current == none) {
+                        break;
+                    }
+                }
+
+                return str.substr(0, common);
+            }
+
+            /**
+             * @return The number of nodes in a tree, the same as TST::size.
+             */
+            size_t size() const {
+                return nodes.size();
+            }
+
+            bool empty() const {
+                return nodes.empty();
+            }
+
+            /**
+             * @return The number of bytes taken by the arena.
+             */
+            size_t memory_usage() const {
+                return nodes.capacity() * sizeof(Node);
+            }
+        };
+    }
+}
+
+#endif //SRC_ARENA_TST_H
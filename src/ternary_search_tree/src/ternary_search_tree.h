@@ -1,7 +1,14 @@
 #ifndef SRC_TST_H
 #define SRC_TST_H
 
+#include <queue>
 #include <string>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <initializer_list>
 #include <memory>
 #include <stdexcept>
 #include <iostream>
@@ -33,13 +40,52 @@ namespace algo_lib {
             Acc fold(Iter first, Iter last, Acc acc, Functor functor) {
                 return first != last ? fold(std::next(first, 1), last, functor(acc, *first), functor) : acc;
             }
+
+            /**
+             * @brief Optional weights of the TST nodes: a weight of a sequence ending in a node and
+             * the maximum weight of all of the sequences in its subtree (the lowest value if there are none).
+             */
+            template<typename Weight>
+            struct weight_annotation {
+                static_assert(std::is_arithmetic<Weight>::value, "Weights of a TST should be arithmetic.");
+                using weight_type = Weight;
+
+                const Weight weight;
+                Weight max_weight;
+
+                template<typename Node>
+                weight_annotation(const Weight w, const bool is_word, const Node *l, const Node *m, const Node *r)
+                        : weight(w), max_weight(is_word ? w : std::numeric_limits<Weight>::lowest()) {
+                    for (const Node *child : {l, m, r}) {
+                        if (child != nullptr && child->max_weight > max_weight) {
+                            max_weight = child->max_weight;
+                        }
+                    }
+                }
+            };
+
+            struct no_weight {
+            };
+
+            /**
+             * An unweighted tree, nodes do not keep anything.
+             */
+            template<>
+            struct weight_annotation<void> {
+                using weight_type = no_weight;
+
+                template<typename Node>
+                weight_annotation(no_weight, bool, const Node *, const Node *, const Node *) {}
+            };
         }
 
         /**
          * @brief Ternary Search Tree (in short TST) implemented as a persistent data structure.
          * @tparam C Type of elements stored in a tree. It is essential for that type to have comparators implemented.
+         * @tparam Weight Arithmetic type of the sequences' weights (scores), void (default) for an unweighted tree.
+         * Every node of a weighted tree keeps the maximum weight of its subtree, which is used by top_k.
          */
-        template<typename C = char>
+        template<typename C = char, typename Weight = void>
         class TST {
         private:
             /**
@@ -47,7 +93,9 @@ namespace algo_lib {
              * Basically, even though it could be omitted it is easier to
              * check some of the boundaries like 'empty tree' with it.
              */
-            struct Node {
+            using weight_type = typename detail::weight_annotation<Weight>::weight_type;
+
+            struct Node : detail::weight_annotation<Weight> {
                 const std::shared_ptr<const Node> left_tst;
                 const std::shared_ptr<const Node> middle_tst;
                 const std::shared_ptr<const Node> right_tst;
@@ -58,8 +106,10 @@ namespace algo_lib {
                      const std::shared_ptr<const Node> &m,
                      const std::shared_ptr<const Node> &r,
                      const C &v,
-                     const bool is_word)
-                        : left_tst(l), middle_tst(m), right_tst(r), data(v), is_end(is_word) {}
+                     const bool is_word,
+                     const weight_type &w)
+                        : detail::weight_annotation<Weight>(w, is_word, l.get(), m.get(), r.get()),
+                          left_tst(l), middle_tst(m), right_tst(r), data(v), is_end(is_word) {}
             };
 
             const std::shared_ptr<const Node> tst_data;
@@ -76,26 +126,97 @@ namespace algo_lib {
             TST(const std::shared_ptr<const Node> tst_data)
                     : tst_data(tst_data) {}
 
-            TST(const TST &left, const TST &middle, const TST &right, const C &value, const bool end_of_word)
+            TST(const TST &left, const TST &middle, const TST &right, const C &value, const bool end_of_word,
+                const weight_type &weight = weight_type())
                     : tst_data(std::make_shared<const Node>(
                     left.tst_data,
                     middle.tst_data,
                     right.tst_data,
                     value,
-                    end_of_word)
+                    end_of_word,
+                    weight)
             ) {}
 
+            /**
+             * @return A weight kept in the root (nothing for an unweighted tree).
+             */
+            weight_type own_weight() const {
+                if constexpr (std::is_void<Weight>::value) {
+                    return weight_type();
+                } else {
+                    return tst_data->weight;
+                }
+            }
+
+            /**
+             * @brief A tree with a single sequence.
+             */
+            static TST chain(const C *str, const weight_type &weight) {
+                return str[0] ? TST(TST(), chain(str + 1, weight), TST(), str[0], str[1] == '\0', weight) : TST();
+            }
+
+            /**
+             * @brief Adds a sequence of elements, copying the nodes on the path.
+             * @param weight A weight of the sequence.
+             * @param assign Whether the weight of an already present sequence should be replaced.
+             */
+            TST add(const C *str, const weight_type &weight, const bool assign) const {
+                return empty() ? chain(str, weight)
+                               : !str[0] ? *this
+                                         : str[0] > value() ? TST(left(), center(), right().add(str, weight, assign),
+                                                                  value(), word(), own_weight())
+                                                            : str[0] < value() ? TST(left().add(str, weight, assign),
+                                                                                     center(), right(), value(),
+                                                                                     word(), own_weight())
+                                                                               : str[1] == '\0'
+                                                                                 ? TST(left(), center(), right(), value(), true,
+                                                                                       assign || !word() ? weight : own_weight())
+                                                                                 : TST(left(), center().add(str + 1, weight, assign),
+                                                                                       right(), value(), word(), own_weight());
+            }
+
+            /**
+             * @return The node in which a given (non empty) sequence ends, nullptr if there is none.
+             */
+            const Node *find_node(const std::basic_string<C> &str) const {
+                size_t matched = 0;
+
+                for (const Node *node = tst_data.get(); node != nullptr;) {
+                    if (str[matched] > node->data) {
+                        node = node->right_tst.get();
+                    } else if (str[matched] < node->data) {
+                        node = node->left_tst.get();
+                    } else if (++matched == str.size()) {
+                        return node;
+                    } else {
+                        node = node->middle_tst.get();
+                    }
+                }
+
+                return nullptr;
+            }
+
             /**
              * @brief For each sequence t in TST calculates the number of common elements in a given sequence and t.
              * @param str Sequence of elements, must end with '\0'
              * @return Number of common elements indicated by brief.
+             *
+             * It walks the raw node pointers, so no TST (and no std::shared_ptr) is copied on the way.
              */
             size_t prefix_calculator(const C *str) const {
-                return (str[0] && empty()) || (str[0] == '\0' && !empty()) ? 0 :
-                       str[0] == '\0' ? 0
-                                      : str[0] == value() ? 1 + center().prefix_calculator(str + 1)
-                                                          : str[0] > value() ? right().prefix_calculator(str)
-                                                                             : left().prefix_calculator(str);
+                size_t common = 0;
+
+                for (const Node *node = tst_data.get(); node != nullptr && str[0] != '\0';) {
+                    if (str[0] == node->data) {
+                        ++common;
+                        ++str;
+                        node = node->middle_tst.get();
+                    } else {
+                        node = str[0] > node->data ? node->right_tst.get() : node->left_tst.get();
+                    }
+                }
+
+                return common;
             }
 
         public:
@@ -105,8 +226,7 @@ namespace algo_lib {
                     : TST(str.c_str()) {}
 
             TST(const C *str)
-                    : TST(str[0] ? TST(TST(), TST(str + 1), TST(), str[0], str[1] == '\0')
-                                 : TST()) {}
+                    : TST(chain(str, weight_type())) {}
 
             TST operator+(const std::basic_string<C> &str) const {
                 return this->operator+(str.c_str());
@@ -117,16 +237,11 @@ namespace algo_lib {
              * return a new one with elements from the previous and a new sequence.
              * @param str Sequence of elements to add, must end with '\0'
              * @return New TST
+             *
+             * In a weighted tree a new sequence gets Weight(), a present one keeps its weight.
              */
             TST operator+(const C *str) const {
-                return empty() ? TST(str)
-                               : str[0] ? str[0] > value() ? TST(left(), center(), right() + (str), value(), word())
-                                                           : str[0] < value() ? TST(left() + (str), center(), right(),
-                                                                                    value(), word())
-                                                                              : TST(left(), center() + (str + 1),
-                                                                                    right(), value(),
-                                                                                    word() || str[1] == '\0')
-                                        : TST(left(), center(), right(), value(), word());
+                return add(str, weight_type(), false);
             }
 
             C value() const {
@@ -195,30 +310,334 @@ namespace algo_lib {
              *
              * NOTE:
              * It traverses the tree reverse in-order traversal. That is, first right ten middle then left.
+             * A node is passed to the functor after all of its subtrees.
+             *
+             * The traversal uses an explicit stack of raw node pointers, so it is not limited by the depth of a tree.
              */
             template<typename Acc, typename Functor>
             Acc fold(Acc acc, Functor functor) const {
-                return empty() ? acc
-                               : functor(left().fold(center().fold(right().fold(
-                                acc,
-                                functor), functor), functor), value());
+                // a node is pushed twice, as 'expand the subtrees' and later as 'visit the node itself'
+                std::vector<std::pair<const Node *, bool>> stack;
+                if (!empty()) {
+                    stack.push_back({tst_data.get(), false});
+                }
+
+                while (!stack.empty()) {
+                    const auto top = stack.back();
+                    stack.pop_back();
+
+                    if (top.second) {
+                        acc = functor(acc, top.first->data);
+                        continue;
+                    }
+
+                    stack.push_back({top.first, true});
+                    for (const Node *child : {top.first->left_tst.get(), top.first->middle_tst.get(),
+                                              top.first->right_tst.get()}) {
+                        if (child != nullptr) {
+                            stack.push_back({child, false});
+                        }
+                    }
+                }
+
+                return acc;
             }
 
+            /**
+             * @return The number of nodes in a tree.
+             */
             size_t size() const {
-                return this->fold((size_t) 0,
-                                  [](const size_t acc, C) { return acc + 1; });
+                size_t count = 0;
+                std::vector<const Node *> stack;
+                if (!empty()) {
+                    stack.push_back(tst_data.get());
+                }
+
+                while (!stack.empty()) {
+                    const Node *node = stack.back();
+                    stack.pop_back();
+                    ++count;
+
+                    for (const Node *child : {node->left_tst.get(), node->middle_tst.get(), node->right_tst.get()}) {
+                        if (child != nullptr) {
+                            stack.push_back(child);
+                        }
+                    }
+                }
+
+                return count;
             }
 
             bool exist(const C *str) const {
-                return str[0] == '\0' || empty() ? false
-                                                 : str[1] == '\0' ? str[0] == value() ? word()
-                                                                                      : str[0] > value()
-                                                                                        ? right().exist(str)
-                                                                                        : left().exist(str)
-                                                                  : str[0] == value() ? center().exist(str + 1)
-                                                                                      : str[0] > value()
-                                                                                        ? right().exist(str)
-                                                                                        : left().exist(str);
+                if (str[0] == '\0') {
+                    return false;
+                }
+
+                for (const Node *node = tst_data.get(); node != nullptr;) {
+                    if (str[0] > node->data) {
+                        node = node->right_tst.get();
+                    } else if (str[0] < node->data) {
+                        node = node->left_tst.get();
+                    } else if (str[1] == '\0') {
+                        return node->is_end;
+                    } else {
+                        ++str;
+                        node = node->middle_tst.get();
+                    }
+                }
+
+                return false;
+            }
+
+            /**
+             * @brief An input iterator over the sequences with a common prefix, in the lexicographic order.
+             *
+             * The completions are generated lazily, with an explicit stack of raw node pointers
+             * (the in-order traversal: left subtree, the node, middle subtree, right subtree),
+             * so reading the first n of them does not visit the rest of the subtree.
+             * The iterator shares the ownership of the nodes, so it stays valid when the tree is gone.
+             */
+            class completion_iterator {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = std::basic_string<C>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const value_type *;
+                using reference = const value_type &;
+
+                /**
+                 * @brief The end iterator.
+                 */
+                completion_iterator() = default;
+
+                reference operator*() const {
+                    return sequence;
+                }
+
+                pointer operator->() const {
+                    return &sequence;
+                }
+
+                completion_iterator &operator++() {
+                    advance();
+                    return *this;
+                }
+
+                completion_iterator operator++(int) {
+                    completion_iterator previous = *this;
+                    advance();
+                    return previous;
+                }
+
+                /**
+                 * Every sequence is yielded once, so two valid iterators are equal if they point to the same sequence.
+                 */
+                bool operator==(const completion_iterator &other) const {
+                    return done == other.done && (done || sequence == other.sequence);
+                }
+
+                bool operator!=(const completion_iterator &other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                friend class TST;
+
+                struct frame {
+                    const Node *node;
+                    size_t depth; ///< the number of elements before the node's one
+                    bool visit; ///< false - push the subtrees, true - the node itself (its left subtree is done)
+                };
+
+                /**
+                 * @param root The root of a tree, it keeps the nodes alive.
+                 * @param start The root of the subtree with the completions (nullptr if it is empty).
+                 * @param prefix The prefix of every completion.
+                 * @param prefix_is_word Whether the prefix itself is a sequence in a tree (it is the first one).
+                 */
+                completion_iterator(std::shared_ptr<const Node> root, const Node *start,
+                                    const std::basic_string<C> &prefix, const bool prefix_is_word)
+                        : root(std::move(root)), sequence(prefix), done(false) {
+                    if (start != nullptr) {
+                        stack.push_back({start, prefix.size(), false});
+                    }
+
+                    if (!prefix_is_word) {
+                        advance();
+                    }
+                }
+
+                void advance() {
+                    while (!stack.empty()) {
+                        const frame top = stack.back();
+                        stack.pop_back();
+
+                        if (!top.visit) {
+                            push(top.node->right_tst.get(), top.depth, false);
+                            push(top.node, top.depth, true);
+                            push(top.node->left_tst.get(), top.depth, false);
+                            continue;
+                        }
+
+                        sequence.resize(top.depth);
+                        sequence.push_back(top.node->data);
+                        push(top.node->middle_tst.get(), top.depth + 1, false);
+
+                        if (top.node->is_end) {
+                            return;
+                        }
+                    }
+
+                    done = true;
+                }
+
+                void push(const Node *node, const size_t depth, const bool visit) {
+                    if (node != nullptr) {
+                        stack.push_back({node, depth, visit});
+                    }
+                }
+
+                std::shared_ptr<const Node> root;
+                std::vector<frame> stack;
+                std::basic_string<C> sequence;
+                bool done = true;
+            };
+
+            /**
+             * @brief A range of completion_iterator objects, usable in the range based for loop.
+             */
+            class completion_range {
+            public:
+                explicit completion_range(completion_iterator first)
+                        : first(std::move(first)) {}
+
+                completion_iterator begin() const {
+                    return first;
+                }
+
+                completion_iterator end() const {
+                    return completion_iterator();
+                }
+
+            private:
+                completion_iterator first;
+            };
+
+            /**
+             * @brief Lists all of the sequences starting with a given prefix, in the lexicographic order.
+             * @param prefix A prefix, the empty one lists the whole tree
+             * @return A lazy range, descending to the prefix takes O(|prefix|) steps and
+             * every next completion takes time proportional to the nodes between two consecutive ones.
+             *
+             * f.e.
+             * When the TST consists of "category", "cat", "functor":
+             *
+             * TST.completions("ca") yields "cat", "category"
+             */
+            completion_range completions(const std::basic_string<C> &prefix) const {
+                if (prefix.empty()) {
+                    return completion_range(completion_iterator(tst_data, tst_data.get(), prefix, false));
+                }
+
+                const Node *node = find_node(prefix);
+                return node == nullptr ? completion_range(completion_iterator())
+                                       : completion_range(completion_iterator(
+                                tst_data, node->middle_tst.get(), prefix, node->is_end));
+            }
+
+            /**
+             * @return At most @n first (in the lexicographic order) sequences starting with a given prefix.
+             */
+            std::vector<std::basic_string<C>> complete(const std::basic_string<C> &prefix, const size_t n) const {
+                std::vector<std::basic_string<C>> result;
+
+                const auto range = completions(prefix);
+                for (auto it = range.begin(); result.size() < n && it != range.end(); ++it) {
+                    result.push_back(*it);
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Adds a sequence with a given weight (replacing the previous weight if it was present),
+             * only for the weighted trees.
+             * @return New TST
+             */
+            template<typename W = Weight, typename = std::enable_if_t<!std::is_void<W>::value>>
+            TST insert(const std::basic_string<C> &str, const W weight) const {
+                return add(str.c_str(), weight, true);
+            }
+
+            /**
+             * @return The maximum weight of a sequence in a tree, only for the weighted trees.
+             */
+            template<typename W = Weight, typename = std::enable_if_t<!std::is_void<W>::value>>
+            W max_weight() const {
+                throw_logic_error_if_violated();
+                return tst_data->max_weight;
+            }
+
+            /**
+             * @brief Finds @k sequences with the highest weights among the ones starting with a given prefix,
+             * only for the weighted trees.
+             * @return Pairs (sequence, weight), the heaviest first.
+             *
+             * It is a best first search over the subtrees ordered by their maximum weights,
+             * so it visits only the nodes on the paths to the results (and their siblings),
+             * instead of all of the completions.
+             */
+            template<typename W = Weight, typename = std::enable_if_t<!std::is_void<W>::value>>
+            std::vector<std::pair<std::basic_string<C>, W>> top_k(const std::basic_string<C> &prefix,
+                                                                  const size_t k) const {
+                struct candidate {
+                    W priority;
+                    const Node *subtree; ///< nullptr for a complete sequence
+                    std::basic_string<C> sequence; ///< elements before the subtree, or the sequence itself
+
+                    bool operator<(const candidate &other) const {
+                        return priority < other.priority;
+                    }
+                };
+
+                std::priority_queue<candidate> queue;
+                auto push_subtree = [&queue](const Node *node, const std::basic_string<C> &before) {
+                    if (node != nullptr && node->max_weight > std::numeric_limits<W>::lowest()) {
+                        queue.push({node->max_weight, node, before});
+                    }
+                };
+
+                if (prefix.empty()) {
+                    push_subtree(tst_data.get(), prefix);
+                } else if (const Node *node = find_node(prefix)) {
+                    if (node->is_end) {
+                        queue.push({node->weight, nullptr, prefix});
+                    }
+                    push_subtree(node->middle_tst.get(), prefix);
+                }
+
+                std::vector<std::pair<std::basic_string<C>, W>> result;
+                while (result.size() < k && !queue.empty()) {
+                    const candidate best = queue.top();
+                    queue.pop();
+
+                    if (best.subtree == nullptr) {
+                        result.push_back({best.sequence, best.priority});
+                        continue;
+                    }
+
+                    const Node *node = best.subtree;
+                    const std::basic_string<C> extended = best.sequence + node->data;
+
+                    push_subtree(node->left_tst.get(), best.sequence);
+                    push_subtree(node->right_tst.get(), best.sequence);
+                    push_subtree(node->middle_tst.get(), extended);
+                    if (node->is_end) {
+                        queue.push({node->weight, nullptr, extended});
+                    }
+                }
+
+                return result;
             }
         };
     }
@@ -0,0 +1,56 @@
+#define BOOST_TEST_MODULE arena_tst_tests
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <random>
+#include "../src/ternary_search_tree.h"
+#include "../src/arena_tst.h"
+
+BOOST_AUTO_TEST_SUITE(simple);
+
+    BOOST_AUTO_TEST_CASE(simple_test_case) {
+        algo_lib::tree::arena_tst<char> t;
+
+        BOOST_CHECK(!t.exist("test"));
+        BOOST_CHECK_EQUAL(t.prefix("test"), "");
+
+        BOOST_CHECK(t.insert("test"));
+        BOOST_CHECK(t.insert("dddd"));
+        BOOST_CHECK(t.insert(std::string("tedd")));
+        BOOST_CHECK(!t.insert("test"));
+        BOOST_CHECK(!t.insert(""));
+
+        BOOST_CHECK(t.exist("test"));
+        BOOST_CHECK(t.exist("tedd"));
+        BOOST_CHECK(!t.exist("ted"));
+        BOOST_CHECK(!t.exist(""));
+
+        BOOST_CHECK_EQUAL(t.prefix("ted"), "ted");
+        BOOST_CHECK_EQUAL(t.prefix("dff"), "d");
+        BOOST_CHECK_EQUAL(t.prefix("ff"), "");
+        BOOST_CHECK_EQUAL(t.size(), 10);
+    }
+
+    BOOST_AUTO_TEST_CASE(against_persistent) {
+        std::mt19937 gen(23);
+        std::vector<std::string> words;
+        for (int i = 0; i < 500; ++i) {
+            std::string word(1 + gen() % 8, 'a');
+            for (auto &c : word) {
+                c = (char) ('a' + gen() % 4);
+            }
+            words.push_back(word);
+        }
+
+        using TST = algo_lib::tree::TST<char>;
+        const TST persistent = algo_lib::tree::detail::fold(
+                words.begin(), words.begin() + 250, TST(), [](const TST &t, const std::string &word) { return t + word; });
+        algo_lib::tree::arena_tst<char> arena(words.begin(), words.begin() + 250);
+
+        BOOST_CHECK_EQUAL(arena.size(), persistent.size());
+        for (const auto &word : words) {
+            BOOST_CHECK_EQUAL(arena.exist(word), persistent.exist(word));
+            BOOST_CHECK_EQUAL(arena.prefix(word + "b"), persistent.prefix(word + "b"));
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END();
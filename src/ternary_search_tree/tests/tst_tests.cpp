@@ -1,6 +1,7 @@
 #define BOOST_TEST_MODULE tst_tests
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/execution_monitor.hpp>
+#include <functional>
 #include "../src/ternary_search_tree.h"
 
 template <typename T>
@@ -62,4 +63,75 @@ BOOST_AUTO_TEST_SUITE(simple);
         BOOST_CHECK_THROW(t4.center().center(), std::logic_error);
     }
 
+    BOOST_AUTO_TEST_CASE(iterative_read_paths) {
+        const auto t = TST<char>{"category"} + "functor" + "theory" + "cat" + "fun" + "a";
+
+        // the reference, recursive fold: right, middle, left, then the node
+        std::function<std::string(const TST<char> &, std::string)> reference = [&](const TST<char> &tree, std::string acc) {
+            return tree.empty() ? acc : reference(tree.left(), reference(tree.center(), reference(tree.right(), acc))) + tree.value();
+        };
+        BOOST_CHECK_EQUAL(t.fold(std::string(), [](std::string acc, char c) { return acc + c; }), reference(t, ""));
+        BOOST_CHECK_EQUAL(t.size(), reference(t, "").size());
+
+        BOOST_CHECK(t.exist("cat"));
+        BOOST_CHECK(t.exist("a"));
+        BOOST_CHECK(!t.exist("ca"));
+        BOOST_CHECK(!t.exist(""));
+        BOOST_CHECK_EQUAL(t.prefix("catamorphism"), "cat");
+        BOOST_CHECK_EQUAL(TST<char>{}.prefix("cat"), "");
+
+        const std::string long_key(10000, 'x');
+        const auto deep = t + long_key;
+        BOOST_CHECK(deep.exist(long_key));
+        BOOST_CHECK_EQUAL(deep.prefix(long_key + "y").size(), long_key.size());
+        BOOST_CHECK_EQUAL(deep.size(), t.size() + long_key.size());
+    }
+
+    BOOST_AUTO_TEST_CASE(ordered_completions) {
+        using strings = std::vector<std::string>;
+        const auto t = TST<char>{"category"} + "functor" + "cat" + "catamorphism" + "car" + "theory" + "c";
+
+        BOOST_CHECK((t.complete("cat", 10) == strings{"cat", "catamorphism", "category"}));
+        BOOST_CHECK((t.complete("ca", 2) == strings{"car", "cat"}));
+        BOOST_CHECK((t.complete("c", 1) == strings{"c"}));
+        BOOST_CHECK((t.complete("", 100) == strings{"c", "car", "cat", "catamorphism", "category", "functor", "theory"}));
+        BOOST_CHECK(t.complete("dog", 5).empty());
+        BOOST_CHECK(t.complete("categoryx", 5).empty());
+        BOOST_CHECK(TST<char>{}.complete("", 5).empty());
+
+        // lazy iteration, and the iterator keeps the nodes alive
+        auto range = (t + "cab").completions("ca");
+        auto it = range.begin();
+        BOOST_CHECK_EQUAL(*it, "cab");
+        BOOST_CHECK_EQUAL(*++it, "car");
+        BOOST_CHECK_EQUAL(it->size(), 3);
+
+        size_t count = 0;
+        for (const auto &word : t.completions("")) {
+            BOOST_CHECK(t.exist(word));
+            ++count;
+        }
+        BOOST_CHECK_EQUAL(count, 7);
+    }
+
+    BOOST_AUTO_TEST_CASE(top_k_by_weight) {
+        using weighted = algo_lib::tree::TST<char, int>;
+        using results = std::vector<std::pair<std::string, int>>;
+
+        const auto t = weighted{}.insert("cat", 5).insert("car", 9).insert("category", 7)
+                .insert("cargo", 1).insert("dog", 20) + "cab";
+
+        BOOST_CHECK_EQUAL(t.max_weight(), 20);
+        BOOST_CHECK((t.top_k("ca", 2) == results{{"car", 9}, {"category", 7}}));
+        BOOST_CHECK((t.top_k("", 1) == results{{"dog", 20}}));
+        BOOST_CHECK((t.top_k("cat", 5) == results{{"category", 7}, {"cat", 5}}));
+        BOOST_CHECK(t.top_k("x", 5).empty());
+
+        const auto updated = t.insert("cargo", 30) + "car";
+        BOOST_CHECK((updated.top_k("car", 3) == results{{"cargo", 30}, {"car", 9}}));
+        BOOST_CHECK_EQUAL(updated.max_weight(), 30);
+        BOOST_CHECK_EQUAL(t.max_weight(), 20);
+        BOOST_CHECK((updated.complete("ca", 10) == std::vector<std::string>{"cab", "car", "cargo", "cat", "category"}));
+    }
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file